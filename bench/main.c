@@ -0,0 +1,1097 @@
+#include "LinkedList/LinkedList.h"
+#include "LinkedList/ListSharded.h"
+#include "LinkedList/LockFreeList.h"
+#include "LinkedList/LruCache.h"
+#include "LinkedList/WorkDeque.h"
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef struct Zipf
+{
+	double* cumulative;
+	size_t keyCount;
+	uint64_t state;
+} Zipf;
+
+static double GetSeconds(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+static uint64_t NextRandom(uint64_t* state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+
+	return *state;
+}
+
+static int ZipfInitialise(Zipf* zipf, size_t keyCount, double exponent, uint64_t seed)
+{
+	zipf->cumulative = malloc(keyCount * sizeof(double));
+
+	if (zipf->cumulative == NULL)
+	{
+		return -1;
+	}
+
+	double sum = 0;
+
+	for (size_t i = 0; i < keyCount; i++)
+	{
+		sum += 1.0 / pow((double)(i + 1), exponent);
+		zipf->cumulative[i] = sum;
+	}
+
+	for (size_t i = 0; i < keyCount; i++)
+	{
+		zipf->cumulative[i] /= sum;
+	}
+
+	zipf->keyCount = keyCount;
+	zipf->state = seed;
+
+	return 0;
+}
+
+static void ZipfDestroy(Zipf* zipf)
+{
+	free(zipf->cumulative);
+	zipf->cumulative = NULL;
+}
+
+static uint32_t ZipfNext(Zipf* zipf)
+{
+	double sample = (NextRandom(&zipf->state) >> 11) * (1.0 / 9007199254740992.0);
+	size_t low = 0;
+	size_t high = zipf->keyCount - 1;
+
+	while (low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+
+		if (zipf->cumulative[middle] < sample)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	return (uint32_t)low;
+}
+
+typedef struct LruRecord
+{
+	uint32_t key;
+	uint32_t value;
+} LruRecord;
+
+static int CompareRecordKeys(const void* itemOne, const void* itemTwo)
+{
+	return ((const LruRecord*)itemOne)->key != ((const LruRecord*)itemTwo)->key;
+}
+
+static void BenchLruList(size_t capacity, size_t keyCount, size_t operations)
+{
+	Zipf zipf;
+	LinkedList* list = ListInitialise(sizeof(LruRecord));
+
+	if (ZipfInitialise(&zipf, keyCount, 0.99, 88172645463325252ULL) != 0 || list == NULL)
+	{
+		return;
+	}
+
+	size_t hits = 0;
+	double start = GetSeconds();
+
+	for (size_t i = 0; i < operations; i++)
+	{
+		LruRecord record = { ZipfNext(&zipf), (uint32_t)i };
+		size_t index = 0;
+
+		if (ListGetIndex(list, &index, &record, CompareRecordKeys) == 0)
+		{
+			ListPopAt(list, index);
+			hits++;
+		}
+		else if (ListCount(list) == capacity)
+		{
+			ListPopBack(list);
+		}
+
+		ListPushFront(list, &record);
+	}
+
+	double seconds = GetSeconds() - start;
+
+	printf("LinkedList LRU  capacity %8zu keys %9zu: %12.0f ops/s, hit rate %5.1f%%\n", capacity, keyCount,
+		operations / seconds, 100.0 * hits / operations);
+
+	ListDestroy(&list);
+	ZipfDestroy(&zipf);
+}
+
+static void BenchLruCache(size_t capacity, size_t keyCount, size_t operations)
+{
+	Zipf zipf;
+	LruCache* cache = LruInitialise(capacity, sizeof(uint32_t), sizeof(uint32_t), NULL, NULL);
+
+	if (ZipfInitialise(&zipf, keyCount, 0.99, 88172645463325252ULL) != 0 || cache == NULL)
+	{
+		return;
+	}
+
+	size_t hits = 0;
+	double start = GetSeconds();
+
+	for (size_t i = 0; i < operations; i++)
+	{
+		uint32_t key = ZipfNext(&zipf);
+		uint32_t value = (uint32_t)i;
+		void* cachedValue = NULL;
+
+		if (LruGet(cache, &key, &cachedValue) == 0)
+		{
+			hits++;
+		}
+		else
+		{
+			LruPut(cache, &key, &value);
+		}
+	}
+
+	double seconds = GetSeconds() - start;
+
+	printf("LruCache        capacity %8zu keys %9zu: %12.0f ops/s, hit rate %5.1f%%\n", capacity, keyCount,
+		operations / seconds, 100.0 * hits / operations);
+
+	LruDestroy(&cache);
+	ZipfDestroy(&zipf);
+}
+
+static void* AllocateMemory(void* ctx, size_t size)
+{
+	(void)ctx;
+
+	return malloc(size);
+}
+
+static void FreeMemory(void* ctx, void* pointer, size_t size)
+{
+	(void)ctx;
+	(void)size;
+
+	free(pointer);
+}
+
+static void BenchAllocator(const char* name, const ListAllocator* allocator, size_t elementCount, size_t rounds)
+{
+	LinkedList* list = ListInitialiseWithAllocator(sizeof(uint64_t), allocator);
+
+	if (list == NULL)
+	{
+		return;
+	}
+
+	double start = GetSeconds();
+
+	for (size_t round = 0; round < rounds; round++)
+	{
+		for (uint64_t i = 0; i < elementCount; i++)
+		{
+			ListPushFront(list, &i);
+		}
+
+		ListClear(list);
+	}
+
+	double seconds = GetSeconds() - start;
+
+	printf("%-15s elements %8zu: %12.0f push/free pairs/s\n", name, elementCount,
+		(double)elementCount * rounds / seconds);
+
+	ListDestroy(&list);
+}
+
+typedef struct ReaderBench
+{
+	LinkedList* list;
+	int* stop;
+	size_t reads;
+} ReaderBench;
+
+static void* RunReader(void* argument)
+{
+	ReaderBench* bench = argument;
+	uint64_t state = (uint64_t)(uintptr_t)argument | 1;
+
+	while (!__atomic_load_n(bench->stop, __ATOMIC_ACQUIRE))
+	{
+		ListReadBegin(bench->list);
+
+		size_t count = ListCount(bench->list);
+		uint32_t* value = NULL;
+
+		if (count > 0)
+		{
+			ListGetItem(bench->list, NextRandom(&state) % count, (void*)&value);
+		}
+
+		ListReadEnd(bench->list);
+
+		bench->reads++;
+	}
+
+	return NULL;
+}
+
+static void BenchConcurrentReaders(size_t readerCount, size_t elementCount, double seconds)
+{
+	LinkedList* list = ListInitialiseConcurrent(sizeof(uint32_t));
+	ReaderBench readers[64];
+	pthread_t threads[64];
+	int stop = 0;
+
+	if (list == NULL || readerCount > 64)
+	{
+		return;
+	}
+
+	for (uint32_t i = 0; i < elementCount; i++)
+	{
+		ListPushFront(list, &i);
+	}
+
+	for (size_t i = 0; i < readerCount; i++)
+	{
+		readers[i] = (ReaderBench) { list, &stop, 0 };
+		pthread_create(&threads[i], NULL, RunReader, &readers[i]);
+	}
+
+	size_t writes = 0;
+	double start = GetSeconds();
+
+	while (GetSeconds() - start < seconds)
+	{
+		uint32_t item = (uint32_t)writes++;
+
+		ListPushFront(list, &item);
+		ListPopAt(list, 1);
+	}
+
+	__atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+
+	size_t reads = 0;
+
+	for (size_t i = 0; i < readerCount; i++)
+	{
+		pthread_join(threads[i], NULL);
+		reads += readers[i].reads;
+	}
+
+	printf("Concurrent list readers %2zu elements %6zu: %12.0f reads/s, %12.0f writes/s\n", readerCount, elementCount,
+		reads / seconds, writes / seconds);
+
+	ListDestroy(&list);
+}
+
+typedef struct RingBench
+{
+	LinkedList* list;
+	size_t batchSize;
+	size_t itemCount;
+} RingBench;
+
+static void* RunRingProducer(void* argument)
+{
+	RingBench* bench = argument;
+	uint64_t items[256];
+	uint64_t next = 0;
+
+	while (next < bench->itemCount)
+	{
+		size_t count = bench->itemCount - next < bench->batchSize ? bench->itemCount - next : bench->batchSize;
+		size_t pushedCount = 0;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			items[i] = next + i;
+		}
+
+		if (ListPushBackMany(bench->list, items, count, &pushedCount) != 0)
+		{
+			sched_yield();
+		}
+
+		next += pushedCount;
+	}
+
+	return NULL;
+}
+
+static void BenchRing(size_t capacity, size_t batchSize, size_t itemCount)
+{
+	RingBench bench = { ListInitialiseRing(sizeof(uint64_t), capacity), batchSize, itemCount };
+	pthread_t producer;
+	uint64_t items[256];
+	uint64_t sum = 0;
+
+	if (bench.list == NULL || batchSize > 256)
+	{
+		return;
+	}
+
+	double start = GetSeconds();
+
+	pthread_create(&producer, NULL, RunRingProducer, &bench);
+
+	for (size_t received = 0; received < itemCount;)
+	{
+		size_t poppedCount = 0;
+
+		if (ListPopFrontMany(bench.list, items, batchSize, &poppedCount) != 0)
+		{
+			sched_yield();
+		}
+
+		for (size_t i = 0; i < poppedCount; i++)
+		{
+			sum += items[i];
+		}
+
+		received += poppedCount;
+	}
+
+	pthread_join(producer, NULL);
+
+	double seconds = GetSeconds() - start;
+
+	printf("SPSC ring capacity %6zu batch %3zu: %12.0f items/s (checksum %llu)\n", capacity, batchSize,
+		itemCount / seconds, (unsigned long long)sum);
+
+	ListDestroy(&bench.list);
+}
+
+typedef struct AppendBench
+{
+	LinkedList* list;
+	pthread_mutex_t* lock;
+	ListSharded* sharded;
+	size_t shard;
+	size_t itemCount;
+} AppendBench;
+
+static void* RunAppender(void* argument)
+{
+	AppendBench* bench = argument;
+
+	for (uint64_t i = 0; i < bench->itemCount; i++)
+	{
+		if (bench->sharded != NULL)
+		{
+			ListShardedPushBack(bench->sharded, bench->shard, &i);
+		}
+		else
+		{
+			pthread_mutex_lock(bench->lock);
+			ListPushBack(bench->list, &i);
+			pthread_mutex_unlock(bench->lock);
+		}
+	}
+
+	return NULL;
+}
+
+static void BenchAppend(int useShards, size_t writerCount, size_t itemCount)
+{
+	LinkedList* list = ListInitialise(sizeof(uint64_t));
+	ListSharded* sharded = useShards ? ListShardedInitialise(sizeof(uint64_t), writerCount) : NULL;
+	pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+	AppendBench appenders[64];
+	pthread_t threads[64];
+
+	if (list == NULL || (useShards && sharded == NULL) || writerCount > 64)
+	{
+		return;
+	}
+
+	double start = GetSeconds();
+
+	for (size_t i = 0; i < writerCount; i++)
+	{
+		appenders[i] = (AppendBench) { list, &lock, sharded, i, itemCount / writerCount };
+		pthread_create(&threads[i], NULL, RunAppender, &appenders[i]);
+	}
+
+	for (size_t i = 0; i < writerCount; i++)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	double collectStart = GetSeconds();
+
+	if (useShards)
+	{
+		ListShardedCollect(sharded, list);
+	}
+
+	double end = GetSeconds();
+
+	printf("Append %-7s writers %2zu: %12.0f items/s, collect %8.3f ms\n", useShards ? "sharded" : "locked", writerCount,
+		ListCount(list) / (end - start), (end - collectStart) * 1000);
+
+	if (useShards)
+	{
+		ListShardedDestroy(&sharded);
+	}
+
+	ListDestroy(&list);
+}
+
+typedef struct SetBench
+{
+	LinkedList* list;
+	pthread_mutex_t* lock;
+	LockFreeList* lockFreeList;
+	uint32_t keyCount;
+	size_t operationCount;
+	uint64_t seed;
+} SetBench;
+
+static int CompareIds(const void* itemOne, const void* itemTwo)
+{
+	uint32_t idOne = *(const uint32_t*)itemOne;
+	uint32_t idTwo = *(const uint32_t*)itemTwo;
+
+	return (idOne > idTwo) - (idOne < idTwo);
+}
+
+static void ChangeLockedSet(SetBench* bench, uint32_t id, uint64_t operation)
+{
+	size_t index = 0;
+
+	pthread_mutex_lock(bench->lock);
+
+	int found = ListFindSorted(bench->list, &index, &id) == 0;
+
+	if (operation == 0 && !found)
+	{
+		ListInsertSorted(bench->list, &id);
+	}
+	else if (operation == 1 && found)
+	{
+		ListPopAt(bench->list, index);
+	}
+
+	pthread_mutex_unlock(bench->lock);
+}
+
+/*
+ * One operation in sixteen inserts an id, one removes one and the others look
+ * an id up.
+ */
+static void* RunSetWorker(void* argument)
+{
+	SetBench* bench = argument;
+	uint64_t state = bench->seed;
+
+	for (size_t i = 0; i < bench->operationCount; i++)
+	{
+		uint64_t random = NextRandom(&state);
+		uint32_t id = (uint32_t)(random % bench->keyCount);
+		uint64_t operation = (random >> 32) & 15;
+
+		if (bench->lockFreeList == NULL)
+		{
+			ChangeLockedSet(bench, id, operation);
+		}
+		else if (operation == 0)
+		{
+			LockFreeListInsert(bench->lockFreeList, &id);
+		}
+		else if (operation == 1)
+		{
+			LockFreeListRemove(bench->lockFreeList, &id);
+		}
+		else
+		{
+			LockFreeListContains(bench->lockFreeList, &id);
+		}
+	}
+
+	return NULL;
+}
+
+static void BenchSet(int useLockFree, size_t threadCount, uint32_t keyCount, size_t operationCount)
+{
+	LinkedList* list = ListInitialiseSorted(sizeof(uint32_t), CompareIds);
+	LockFreeList* lockFreeList = useLockFree ? LockFreeListInitialise(sizeof(uint32_t), CompareIds) : NULL;
+	pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+	SetBench benches[64];
+	pthread_t threads[64];
+
+	if (list == NULL || (useLockFree && lockFreeList == NULL) || threadCount > 64)
+	{
+		return;
+	}
+
+	for (uint32_t id = 0; id < keyCount; id += 2)
+	{
+		ListInsertSorted(list, &id);
+
+		if (useLockFree)
+		{
+			LockFreeListInsert(lockFreeList, &id);
+		}
+	}
+
+	double start = GetSeconds();
+
+	for (size_t i = 0; i < threadCount; i++)
+	{
+		benches[i] = (SetBench) { list, &lock, lockFreeList, keyCount, operationCount / threadCount, i + 1 };
+		pthread_create(&threads[i], NULL, RunSetWorker, &benches[i]);
+	}
+
+	for (size_t i = 0; i < threadCount; i++)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	double seconds = GetSeconds() - start;
+
+	printf("Ordered set %-9s threads %2zu: %12.0f operations/s\n", useLockFree ? "lock-free" : "locked", threadCount,
+		operationCount / seconds);
+
+	if (useLockFree)
+	{
+		LockFreeListDestroy(&lockFreeList);
+	}
+
+	ListDestroy(&list);
+}
+
+typedef struct ForkJoinTask
+{
+	uint64_t start;
+	uint64_t end;
+} ForkJoinTask;
+
+typedef struct ForkJoinWorker
+{
+	WorkDeque* deque;
+	LinkedList* list;
+	pthread_mutex_t lock;
+	uint64_t sum;
+	uint64_t state;
+} ForkJoinWorker;
+
+typedef struct ForkJoinBench
+{
+	ForkJoinWorker workers[64];
+	size_t workerCount;
+	int useDeque;
+	uint64_t remaining;
+} ForkJoinBench;
+
+typedef struct ForkJoinThread
+{
+	ForkJoinBench* bench;
+	size_t index;
+} ForkJoinThread;
+
+static void PushTask(ForkJoinBench* bench, ForkJoinWorker* worker, ForkJoinTask* task)
+{
+	if (bench->useDeque)
+	{
+		WorkDequePush(worker->deque, task);
+
+		return;
+	}
+
+	pthread_mutex_lock(&worker->lock);
+	ListPushFront(worker->list, task);
+	pthread_mutex_unlock(&worker->lock);
+}
+
+static int TakeTask(ForkJoinBench* bench, ForkJoinWorker* worker, ForkJoinTask* task, int steal)
+{
+	if (bench->useDeque)
+	{
+		return steal ? WorkDequeSteal(worker->deque, task) : WorkDequePop(worker->deque, task);
+	}
+
+	pthread_mutex_lock(&worker->lock);
+
+	void* item = NULL;
+	int result = ListGetItem(worker->list, 0, &item);
+
+	if (result == 0)
+	{
+		*task = *(ForkJoinTask*)item;
+		ListPopFront(worker->list);
+	}
+
+	pthread_mutex_unlock(&worker->lock);
+
+	return result;
+}
+
+static void RunTask(ForkJoinBench* bench, ForkJoinWorker* worker, ForkJoinTask task)
+{
+	while (task.end - task.start > 256)
+	{
+		ForkJoinTask forkedTask = { task.start + (task.end - task.start) / 2, task.end };
+
+		PushTask(bench, worker, &forkedTask);
+		task.end = forkedTask.start;
+	}
+
+	for (uint64_t i = task.start; i < task.end; i++)
+	{
+		worker->sum += (i * 2654435761u) ^ (i >> 3);
+	}
+
+	__atomic_fetch_sub(&bench->remaining, task.end - task.start, __ATOMIC_RELEASE);
+}
+
+static void* RunForkJoinWorker(void* argument)
+{
+	ForkJoinThread* thread = argument;
+	ForkJoinBench* bench = thread->bench;
+	ForkJoinWorker* worker = &bench->workers[thread->index];
+	ForkJoinTask task;
+
+	while (__atomic_load_n(&bench->remaining, __ATOMIC_ACQUIRE) > 0)
+	{
+		if (TakeTask(bench, worker, &task, 0) == 0)
+		{
+			RunTask(bench, worker, task);
+			continue;
+		}
+
+		ForkJoinWorker* victim = &bench->workers[NextRandom(&worker->state) % bench->workerCount];
+
+		if (victim != worker && TakeTask(bench, victim, &task, 1) == 0)
+		{
+			RunTask(bench, worker, task);
+		}
+		else
+		{
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+static void BenchForkJoin(int useDeque, size_t workerCount, uint64_t itemCount)
+{
+	ForkJoinBench* bench = calloc(1, sizeof(ForkJoinBench));
+	ForkJoinThread threads[64];
+	pthread_t handles[64];
+
+	if (bench == NULL || workerCount > 64)
+	{
+		free(bench);
+
+		return;
+	}
+
+	bench->workerCount = workerCount;
+	bench->useDeque = useDeque;
+	bench->remaining = itemCount;
+
+	for (size_t i = 0; i < workerCount; i++)
+	{
+		bench->workers[i].deque = WorkDequeInitialise(sizeof(ForkJoinTask));
+		bench->workers[i].list = ListInitialise(sizeof(ForkJoinTask));
+		bench->workers[i].state = i + 1;
+		pthread_mutex_init(&bench->workers[i].lock, NULL);
+	}
+
+	ForkJoinTask rootTask = { 0, itemCount };
+	PushTask(bench, &bench->workers[0], &rootTask);
+
+	double start = GetSeconds();
+
+	for (size_t i = 0; i < workerCount; i++)
+	{
+		threads[i] = (ForkJoinThread) { bench, i };
+		pthread_create(&handles[i], NULL, RunForkJoinWorker, &threads[i]);
+	}
+
+	uint64_t sum = 0;
+
+	for (size_t i = 0; i < workerCount; i++)
+	{
+		pthread_join(handles[i], NULL);
+		sum += bench->workers[i].sum;
+	}
+
+	double seconds = GetSeconds() - start;
+
+	printf("Fork-join %-19s workers %2zu: %8.3f s (checksum %llu)\n", useDeque ? "work-stealing deque" : "locked list",
+		workerCount, seconds, (unsigned long long)sum);
+
+	for (size_t i = 0; i < workerCount; i++)
+	{
+		WorkDequeDestroy(&bench->workers[i].deque);
+		ListDestroy(&bench->workers[i].list);
+		pthread_mutex_destroy(&bench->workers[i].lock);
+	}
+
+	free(bench);
+}
+
+static void BenchTraversal(const char* name, LinkedList* list, size_t elementCount, size_t rounds)
+{
+	uint32_t* items = malloc(elementCount * sizeof(uint32_t));
+
+	if (list == NULL || items == NULL)
+	{
+		free(items);
+		ListDestroy(&list);
+
+		return;
+	}
+
+	for (uint32_t i = 0; i < elementCount; i++)
+	{
+		ListPushFront(list, &i);
+	}
+
+	uint64_t sum = 0;
+	double start = GetSeconds();
+
+	for (size_t round = 0; round < rounds; round++)
+	{
+		ListGetRange(list, 0, elementCount, items);
+		sum += items[round % elementCount];
+	}
+
+	double seconds = GetSeconds() - start;
+
+	printf("Traversal %-8s elements %8zu: %12.0f items/s (checksum %llu)\n", name, elementCount,
+		elementCount * rounds / seconds, (unsigned long long)sum);
+
+	free(items);
+	ListDestroy(&list);
+}
+
+static void BenchCompaction(size_t elementCount, size_t rounds)
+{
+	LinkedList* list = ListInitialise(sizeof(uint32_t));
+	uint32_t* items = malloc(elementCount * sizeof(uint32_t));
+	uint64_t state = 42;
+
+	if (list == NULL || items == NULL)
+	{
+		free(items);
+		ListDestroy(&list);
+
+		return;
+	}
+
+	for (size_t i = 0; i < elementCount; i++)
+	{
+		uint32_t item = (uint32_t)NextRandom(&state);
+
+		ListPushBack(list, &item);
+	}
+
+	/* Sorting random items relinks the elements in an order unrelated to their addresses. */
+	ListSortByKey(list, 0, sizeof(uint32_t));
+
+	for (int compacted = 0; compacted <= 1; compacted++)
+	{
+		double fragmentation = 0.0;
+		uint64_t sum = 0;
+
+		ListFragmentation(list, &fragmentation);
+
+		double start = GetSeconds();
+
+		for (size_t round = 0; round < rounds; round++)
+		{
+			ListGetRange(list, 0, elementCount, items);
+			sum += items[round % elementCount];
+		}
+
+		double seconds = GetSeconds() - start;
+
+		printf("Compaction %-6s elements %8zu fragmentation %.2f: %12.0f items/s (checksum %llu)\n",
+			compacted ? "after" : "before", elementCount, fragmentation, elementCount * rounds / seconds,
+			(unsigned long long)sum);
+
+		if (!compacted)
+		{
+			start = GetSeconds();
+			ListCompact(list);
+			printf("Compaction elements %8zu: %.3f s\n", elementCount, GetSeconds() - start);
+		}
+	}
+
+	free(items);
+	ListDestroy(&list);
+}
+
+static void BenchTiered(const char* name, LinkedList* list, size_t itemCount)
+{
+	if (list == NULL)
+	{
+		return;
+	}
+
+	uint64_t sum = 0;
+	double start = GetSeconds();
+
+	for (uint64_t i = 0; i < itemCount; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	while (ListCount(list) > 0)
+	{
+		uint64_t* item = NULL;
+
+		ListGetItem(list, 0, (void**)&item);
+		sum += *item;
+		ListPopFront(list);
+	}
+
+	double seconds = GetSeconds() - start;
+
+	printf("Queue %-8s items %9zu: %12.0f items/s (checksum %llu)\n", name, itemCount, itemCount / seconds,
+		(unsigned long long)sum);
+
+	ListDestroy(&list);
+}
+
+static void BenchIds(const char* name, LinkedList* list, size_t itemCount, size_t rounds)
+{
+	uint64_t* items = malloc(itemCount * sizeof(uint64_t));
+	uint64_t state = 42;
+	uint64_t id = 1000000000;
+
+	if (list == NULL || items == NULL)
+	{
+		free(items);
+		ListDestroy(&list);
+
+		return;
+	}
+
+	double start = GetSeconds();
+
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		id += 1 + NextRandom(&state) % 16;
+		ListPushBack(list, &id);
+	}
+
+	double pushSeconds = GetSeconds() - start;
+	uint64_t sum = 0;
+
+	start = GetSeconds();
+
+	for (size_t round = 0; round < rounds; round++)
+	{
+		ListGetRange(list, 0, itemCount, items);
+		sum += items[round % itemCount];
+	}
+
+	double scanSeconds = GetSeconds() - start;
+
+	printf("Ids %-10s items %8zu: push %12.0f items/s, scan %12.0f items/s (checksum %llu)\n", name, itemCount,
+		itemCount / pushSeconds, itemCount * rounds / scanSeconds, (unsigned long long)sum);
+
+	free(items);
+	ListDestroy(&list);
+}
+
+static int CompareKeys(const void* itemOne, const void* itemTwo)
+{
+	return *(const uint32_t*)itemOne != *(const uint32_t*)itemTwo;
+}
+
+static void BenchOrganisation(const char* name, ListOrganisation organisation, size_t keyCount, double exponent,
+	size_t lookups)
+{
+	Zipf zipf;
+	LinkedList* list = organisation == LIST_ORGANISATION_NONE ? ListInitialise(sizeof(uint32_t)) :
+		ListInitialiseSelfOrganising(sizeof(uint32_t), organisation);
+
+	if (list == NULL || ZipfInitialise(&zipf, keyCount, exponent, 88172645463325252ULL) != 0)
+	{
+		ListDestroy(&list);
+
+		return;
+	}
+
+	for (uint32_t key = 0; key < keyCount; key++)
+	{
+		ListPushBack(list, &key);
+	}
+
+	size_t found = 0;
+	double start = GetSeconds();
+
+	for (size_t i = 0; i < lookups; i++)
+	{
+		/* Scatter the popular ranks over the list; keyCount is a power of two. */
+		uint32_t key = (uint32_t)((ZipfNext(&zipf) * 2654435761u) & (keyCount - 1));
+		size_t index = 0;
+
+		found += ListGetIndex(list, &index, &key, CompareKeys) == 0;
+	}
+
+	double seconds = GetSeconds() - start;
+
+	printf("Zipf %.2f lookup %-13s keys %6zu: %12.0f lookups/s (found %zu)\n", exponent, name, keyCount,
+		lookups / seconds, found);
+
+	ZipfDestroy(&zipf);
+	ListDestroy(&list);
+}
+
+typedef struct SortRecord
+{
+	uint32_t key;
+	uint32_t value;
+} SortRecord;
+
+static int CompareSortRecords(const void* itemOne, const void* itemTwo)
+{
+	uint32_t keyOne = ((const SortRecord*)itemOne)->key;
+	uint32_t keyTwo = ((const SortRecord*)itemTwo)->key;
+
+	return (keyOne > keyTwo) - (keyOne < keyTwo);
+}
+
+static LinkedList* CreateSortList(size_t elementCount)
+{
+	LinkedList* list = ListInitialise(sizeof(SortRecord));
+	uint64_t state = 88172645463325252ULL;
+
+	for (size_t i = 0; list != NULL && i < elementCount; i++)
+	{
+		SortRecord record = { (uint32_t)NextRandom(&state), (uint32_t)i };
+
+		ListPushFront(list, &record);
+	}
+
+	return list;
+}
+
+static void BenchSort(size_t elementCount)
+{
+	LinkedList* list = CreateSortList(elementCount);
+	SortRecord* records = malloc(elementCount * sizeof(SortRecord));
+
+	if (list != NULL && records != NULL)
+	{
+		double start = GetSeconds();
+
+		ListGetRange(list, 0, elementCount, records);
+		qsort(records, elementCount, sizeof(SortRecord), CompareSortRecords);
+		ListReplaceRange(list, 0, elementCount, records);
+
+		printf("Sort %-26s elements %8zu: %8.3f s\n", "qsort and replace", elementCount, GetSeconds() - start);
+	}
+
+	free(records);
+	ListDestroy(&list);
+
+	list = CreateSortList(elementCount);
+
+	if (list != NULL)
+	{
+		double start = GetSeconds();
+
+		ListSortByKey(list, offsetof(SortRecord, key), sizeof(uint32_t));
+
+		printf("Sort %-26s elements %8zu: %8.3f s\n", "ListSortByKey", elementCount, GetSeconds() - start);
+	}
+
+	ListDestroy(&list);
+}
+
+int main(void)
+{
+	BenchLruList(1000, 100000, 200000);
+	BenchLruCache(1000, 100000, 200000);
+	BenchLruCache(100000, 10000000, 10000000);
+
+	ListAllocator mallocAllocator = { AllocateMemory, FreeMemory, NULL };
+
+	BenchAllocator("malloc", &mallocAllocator, 1000, 10000);
+	BenchAllocator("thread cache", &ListThreadCacheAllocator, 1000, 10000);
+
+	for (size_t readers = 1; readers <= 8; readers *= 2)
+	{
+		BenchConcurrentReaders(readers, 64, 1.0);
+	}
+
+	for (size_t batchSize = 1; batchSize <= 256; batchSize *= 16)
+	{
+		BenchRing(4096, batchSize, 10000000);
+	}
+
+	for (size_t writers = 1; writers <= 8; writers *= 2)
+	{
+		BenchAppend(0, writers, 1 << 23);
+		BenchAppend(1, writers, 1 << 23);
+	}
+
+	for (size_t threads = 1; threads <= 8; threads *= 2)
+	{
+		BenchSet(0, threads, 1024, 2000000);
+		BenchSet(1, threads, 1024, 2000000);
+	}
+
+	BenchTraversal("node", ListInitialise(sizeof(uint32_t)), 1 << 22, 10);
+	BenchTraversal("compact", ListInitialiseCompact(sizeof(uint32_t)), 1 << 22, 10);
+	BenchCompaction(1 << 22, 10);
+
+	BenchTiered("deque", ListInitialiseDeque(sizeof(uint64_t)), 1 << 23);
+	BenchTiered("tiered", ListInitialiseTiered(sizeof(uint64_t), "LinkedListBench.spill", 8 << 20), 1 << 23);
+
+	BenchIds("node", ListInitialise(sizeof(uint64_t)), 1 << 22, 10);
+	BenchIds("deque", ListInitialiseDeque(sizeof(uint64_t)), 1 << 22, 10);
+	BenchIds("compressed", ListInitialiseCompressed(sizeof(uint64_t)), 1 << 22, 10);
+
+	double exponents[2] = { 0.99, 1.2 };
+
+	for (size_t i = 0; i < 2; i++)
+	{
+		BenchOrganisation("none", LIST_ORGANISATION_NONE, 4096, exponents[i], 1000000);
+		BenchOrganisation("move to front", LIST_ORGANISATION_MOVE_TO_FRONT, 4096, exponents[i], 1000000);
+		BenchOrganisation("transpose", LIST_ORGANISATION_TRANSPOSE, 4096, exponents[i], 1000000);
+		BenchOrganisation("frequency", LIST_ORGANISATION_FREQUENCY, 4096, exponents[i], 1000000);
+	}
+
+	BenchSort(1 << 22);
+
+	for (size_t workers = 1; workers <= 8; workers *= 2)
+	{
+		BenchForkJoin(0, workers, 1 << 28);
+		BenchForkJoin(1, workers, 1 << 28);
+	}
+
+	return 0;
+}
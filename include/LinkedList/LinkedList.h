@@ -2,6 +2,9 @@
 #define LINKEDLIST_H
 
 #include <stddef.h>
+#include <stdint.h>
+
+#define LIST_LATENCY_BUCKETS 64
 
 typedef enum ErrorCodes
 {
@@ -11,13 +14,43 @@ typedef enum ErrorCodes
 	ERROR_INDEX_NULL = -4,
 	ERROR_ITEM_NULL = -5,
 	ERROR_INVALID_INDEX = -6,
-	ERROR_INVALID_ITEM = -7
+	ERROR_INVALID_ITEM = -7,
+	ERROR_INVALID_OPERATION = -8,
+	ERROR_LIST_FULL = -9
 } ErrorCodes;
 
+typedef enum ListOrganisation
+{
+	LIST_ORGANISATION_NONE = 0,
+	LIST_ORGANISATION_MOVE_TO_FRONT = 1,
+	LIST_ORGANISATION_TRANSPOSE = 2,
+	LIST_ORGANISATION_FREQUENCY = 3
+} ListOrganisation;
+
 typedef struct LinkedList LinkedList;
 
+typedef struct ListAllocator
+{
+	void* (*alloc)(void* ctx, size_t size);
+	void (*free)(void* ctx, void* pointer, size_t size);
+	void* ctx;
+} ListAllocator;
+
+extern const ListAllocator ListThreadCacheAllocator;
+
 LinkedList* ListInitialise(size_t elementSize);
+LinkedList* ListInitialiseWithAllocator(size_t elementSize, const ListAllocator* allocator);
+LinkedList* ListInitialiseSorted(size_t elementSize, int (*compar)(const void*, const void*));
+LinkedList* ListInitialiseConcurrent(size_t elementSize);
+LinkedList* ListInitialiseSelfOrganising(size_t elementSize, ListOrganisation organisation);
+LinkedList* ListInitialiseDeque(size_t elementSize);
+LinkedList* ListInitialiseRing(size_t elementSize, size_t capacity);
+LinkedList* ListInitialiseCompact(size_t elementSize);
+LinkedList* ListInitialiseTiered(size_t elementSize, const char* path, size_t memoryBudget);
+LinkedList* ListInitialiseCompressed(size_t elementSize);
 int ListDestroy(LinkedList** list);
+int ListDestroyAsync(LinkedList** list);
+LinkedList* ListClone(LinkedList* list);
 
 size_t ListCount(LinkedList* list);
 
@@ -32,8 +65,41 @@ int ListPopAt(LinkedList* list, size_t index);
 int ListReplace(LinkedList* list, size_t index, void* item);
 
 int ListClear(LinkedList* list);
+int ListClearIncremental(LinkedList* list, size_t budget);
 
 int ListGetItem(LinkedList* list, size_t index, void** item);
+int ListGetItems(LinkedList* list, const size_t* indices, size_t count, void** items);
 int ListGetIndex(LinkedList* list, size_t* index, void* item, int (*compar)(const void*, const void*));
 
+int ListPushBackMany(LinkedList* list, const void* items, size_t count, size_t* pushedCount);
+int ListPopFrontMany(LinkedList* list, void* items, size_t count, size_t* poppedCount);
+
+int ListGetRange(LinkedList* list, size_t start, size_t count, void* items);
+int ListPopRange(LinkedList* list, size_t start, size_t count);
+int ListReplaceRange(LinkedList* list, size_t start, size_t count, const void* items);
+int ListRotate(LinkedList* list, size_t count);
+
+int ListRemoveIf(LinkedList* list, int (*predicate)(const void*, void*), void* ctx, size_t* removedCount);
+int ListRetainIf(LinkedList* list, int (*predicate)(const void*, void*), void* ctx, size_t* removedCount);
+
+int ListSortByKey(LinkedList* list, size_t keyOffset, size_t keyWidth);
+
+int ListInsertSorted(LinkedList* list, void* item);
+int ListFindSorted(LinkedList* list, size_t* index, void* item);
+int ListLowerBound(LinkedList* list, size_t* index, void* item);
+
+int ListMergeSorted(LinkedList* destination, LinkedList* source, int (*compar)(const void*, const void*));
+int ListConcatenate(LinkedList* destination, LinkedList* source);
+LinkedList* ListIntersectSorted(LinkedList* listOne, LinkedList* listTwo, int (*compar)(const void*, const void*));
+LinkedList* ListDifferenceSorted(LinkedList* listOne, LinkedList* listTwo, int (*compar)(const void*, const void*));
+LinkedList* ListUnionSorted(LinkedList* listOne, LinkedList* listTwo, int (*compar)(const void*, const void*));
+
+int ListCompact(LinkedList* list);
+int ListFragmentation(LinkedList* list, double* fragmentation);
+
+int ListReadBegin(LinkedList* list);
+int ListReadEnd(LinkedList* list);
+
+int ListGetLatencyHistogram(const char* operation, uint64_t* buckets);
+
 #endif
@@ -0,0 +1,17 @@
+#ifndef LISTSHARDED_H
+#define LISTSHARDED_H
+
+#include "LinkedList/LinkedList.h"
+#include <stddef.h>
+
+typedef struct ListSharded ListSharded;
+
+ListSharded* ListShardedInitialise(size_t dataSize, size_t shardCount);
+int ListShardedDestroy(ListSharded** sharded);
+
+size_t ListShardedCount(ListSharded* sharded);
+
+int ListShardedPushBack(ListSharded* sharded, size_t shard, void* item);
+int ListShardedCollect(ListSharded* sharded, LinkedList* destination);
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef LOCKFREELIST_H
+#define LOCKFREELIST_H
+
+#include "LinkedList/LinkedList.h"
+#include <stddef.h>
+
+typedef struct LockFreeList LockFreeList;
+
+LockFreeList* LockFreeListInitialise(size_t dataSize, int (*compar)(const void*, const void*));
+int LockFreeListDestroy(LockFreeList** list);
+
+size_t LockFreeListCount(LockFreeList* list);
+
+int LockFreeListInsert(LockFreeList* list, const void* item);
+int LockFreeListRemove(LockFreeList* list, const void* item);
+int LockFreeListContains(LockFreeList* list, const void* item);
+
+#endif
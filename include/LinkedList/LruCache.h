@@ -0,0 +1,18 @@
+#ifndef LRUCACHE_H
+#define LRUCACHE_H
+
+#include "LinkedList/LinkedList.h"
+#include <stddef.h>
+
+typedef struct LruCache LruCache;
+
+LruCache* LruInitialise(size_t capacity, size_t keySize, size_t valueSize,
+	void (*evict)(const void* key, void* value, void* ctx), void* ctx);
+int LruDestroy(LruCache** cache);
+
+size_t LruCount(LruCache* cache);
+
+int LruGet(LruCache* cache, const void* key, void** value);
+int LruPut(LruCache* cache, const void* key, const void* value);
+
+#endif
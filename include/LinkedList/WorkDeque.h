@@ -0,0 +1,18 @@
+#ifndef WORKDEQUE_H
+#define WORKDEQUE_H
+
+#include "LinkedList/LinkedList.h"
+#include <stddef.h>
+
+typedef struct WorkDeque WorkDeque;
+
+WorkDeque* WorkDequeInitialise(size_t dataSize);
+int WorkDequeDestroy(WorkDeque** deque);
+
+size_t WorkDequeCount(WorkDeque* deque);
+
+int WorkDequePush(WorkDeque* deque, const void* item);
+int WorkDequePop(WorkDeque* deque, void* item);
+int WorkDequeSteal(WorkDeque* deque, void* item);
+
+#endif
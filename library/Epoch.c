@@ -0,0 +1,243 @@
+#include "Epoch.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define EPOCH_CACHE_LINE 64
+#define EPOCH_RECLAIM_INTERVAL 64
+
+/*
+ * Readers announce the global epoch they entered with in their own record.
+ * The global epoch only advances when every active reader has announced the
+ * current epoch, so anything retired at epoch e is unreachable once the
+ * global epoch reaches e + 2.
+ */
+typedef struct EpochRecord
+{
+	uint64_t state;
+	int inUse;
+	struct EpochRecord* next;
+} __attribute__((aligned(EPOCH_CACHE_LINE))) EpochRecord;
+
+static uint64_t globalEpoch = 1;
+static EpochRecord* records = NULL;
+
+static pthread_once_t recordKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t recordKey;
+
+static _Thread_local EpochRecord* threadRecord = NULL;
+static _Thread_local size_t threadNesting = 0;
+
+static void ReleaseRecord(void* record)
+{
+	EpochRecord* epochRecord = record;
+
+	__atomic_store_n(&epochRecord->state, 0, __ATOMIC_RELEASE);
+	__atomic_store_n(&epochRecord->inUse, 0, __ATOMIC_RELEASE);
+}
+
+static void CreateRecordKey(void)
+{
+	pthread_key_create(&recordKey, ReleaseRecord);
+}
+
+static EpochRecord* AcquireRecord(void)
+{
+	pthread_once(&recordKeyOnce, CreateRecordKey);
+
+	EpochRecord* record = __atomic_load_n(&records, __ATOMIC_ACQUIRE);
+
+	while (record != NULL)
+	{
+		int expected = 0;
+
+		if (__atomic_compare_exchange_n(&record->inUse, &expected, 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+		{
+			break;
+		}
+
+		record = record->next;
+	}
+
+	if (record == NULL)
+	{
+		record = aligned_alloc(EPOCH_CACHE_LINE, sizeof(EpochRecord));
+
+		if (record == NULL)
+		{
+			return NULL;
+		}
+
+		record->state = 0;
+		record->inUse = 1;
+		record->next = __atomic_load_n(&records, __ATOMIC_RELAXED);
+
+		while (!__atomic_compare_exchange_n(&records, &record->next, record, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+		{
+		}
+	}
+
+	pthread_setspecific(recordKey, record);
+
+	return record;
+}
+
+int EpochReadBegin(void)
+{
+	if (threadRecord == NULL)
+	{
+		threadRecord = AcquireRecord();
+
+		if (threadRecord == NULL)
+		{
+			return -1;
+		}
+	}
+
+	if (threadNesting++ == 0)
+	{
+		uint64_t epoch = __atomic_load_n(&globalEpoch, __ATOMIC_RELAXED);
+
+		__atomic_store_n(&threadRecord->state, epoch << 1 | 1, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	}
+
+	return 0;
+}
+
+void EpochReadEnd(void)
+{
+	if (threadRecord != NULL && threadNesting > 0 && --threadNesting == 0)
+	{
+		__atomic_store_n(&threadRecord->state, 0, __ATOMIC_RELEASE);
+	}
+}
+
+static uint64_t TryAdvance(void)
+{
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	uint64_t epoch = __atomic_load_n(&globalEpoch, __ATOMIC_RELAXED);
+
+	for (EpochRecord* record = __atomic_load_n(&records, __ATOMIC_ACQUIRE); record != NULL; record = record->next)
+	{
+		uint64_t state = __atomic_load_n(&record->state, __ATOMIC_ACQUIRE);
+
+		if ((state & 1) && (state >> 1) != epoch)
+		{
+			return epoch;
+		}
+	}
+
+	if (__atomic_compare_exchange_n(&globalEpoch, &epoch, epoch + 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+	{
+		return epoch + 1;
+	}
+
+	return epoch;
+}
+
+void EpochSynchronise(void)
+{
+	uint64_t target = __atomic_load_n(&globalEpoch, __ATOMIC_ACQUIRE) + 2;
+
+	while (TryAdvance() < target)
+	{
+		sched_yield();
+	}
+}
+
+void EpochLimboInitialise(EpochLimbo* limbo)
+{
+	limbo->retired = NULL;
+	limbo->first = 0;
+	limbo->count = 0;
+	limbo->capacity = 0;
+}
+
+static void DestroyRetired(EpochLimbo* limbo, uint64_t safeEpoch)
+{
+	while (limbo->count > 0 && limbo->retired[limbo->first].epoch + 2 <= safeEpoch)
+	{
+		EpochRetired* retired = &limbo->retired[limbo->first];
+
+		retired->destroy(retired->ctx, retired->pointer);
+
+		limbo->first = (limbo->first + 1) % limbo->capacity;
+		limbo->count--;
+	}
+}
+
+void EpochLimboDestroy(EpochLimbo* limbo)
+{
+	if (limbo->count > 0)
+	{
+		EpochSynchronise();
+		DestroyRetired(limbo, UINT64_MAX - 2);
+	}
+
+	free(limbo->retired);
+	EpochLimboInitialise(limbo);
+}
+
+void EpochReclaim(EpochLimbo* limbo)
+{
+	if (limbo->count > 0)
+	{
+		DestroyRetired(limbo, TryAdvance());
+	}
+}
+
+static int GrowLimbo(EpochLimbo* limbo)
+{
+	size_t capacity = limbo->capacity == 0 ? EPOCH_RECLAIM_INTERVAL : limbo->capacity * 2;
+	EpochRetired* retired = malloc(capacity * sizeof(EpochRetired));
+
+	if (retired == NULL)
+	{
+		return -1;
+	}
+
+	for (size_t i = 0; i < limbo->count; i++)
+	{
+		retired[i] = limbo->retired[(limbo->first + i) % limbo->capacity];
+	}
+
+	free(limbo->retired);
+
+	limbo->retired = retired;
+	limbo->first = 0;
+	limbo->capacity = capacity;
+
+	return 0;
+}
+
+void EpochRetire(EpochLimbo* limbo, void* pointer, void (*destroy)(void*, void*), void* ctx)
+{
+	if (limbo->count == limbo->capacity)
+	{
+		EpochReclaim(limbo);
+	}
+	if (limbo->count == limbo->capacity && GrowLimbo(limbo) != 0)
+	{
+		EpochSynchronise();
+		destroy(ctx, pointer);
+
+		return;
+	}
+
+	EpochRetired* retired = &limbo->retired[(limbo->first + limbo->count) % limbo->capacity];
+
+	retired->pointer = pointer;
+	retired->destroy = destroy;
+	retired->ctx = ctx;
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	retired->epoch = __atomic_load_n(&globalEpoch, __ATOMIC_RELAXED);
+
+	limbo->count++;
+
+	if (limbo->count % EPOCH_RECLAIM_INTERVAL == 0)
+	{
+		EpochReclaim(limbo);
+	}
+}
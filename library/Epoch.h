@@ -0,0 +1,33 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct EpochRetired
+{
+	void* pointer;
+	void (*destroy)(void*, void*);
+	void* ctx;
+	uint64_t epoch;
+} EpochRetired;
+
+typedef struct EpochLimbo
+{
+	EpochRetired* retired;
+	size_t first;
+	size_t count;
+	size_t capacity;
+} EpochLimbo;
+
+int EpochReadBegin(void);
+void EpochReadEnd(void);
+
+void EpochLimboInitialise(EpochLimbo* limbo);
+void EpochLimboDestroy(EpochLimbo* limbo);
+
+void EpochRetire(EpochLimbo* limbo, void* pointer, void (*destroy)(void*, void*), void* ctx);
+void EpochReclaim(EpochLimbo* limbo);
+void EpochSynchronise(void);
+
+#endif
@@ -1,447 +1,3065 @@
 #include "LinkedList/LinkedList.h"
+#include "Epoch.h"
+#include "ListInternal.h"
+#include "ListStorage.h"
+#include "ListTrace.h"
+#include <pthread.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
+#define LANE_MINIMUM_STRIDE 8
+#define REGION_MAXIMUM_SIZE ((size_t)1 << 20)
+#define SEQUENTIAL_DISTANCE 256
+
 typedef struct LinkedList
 {
 	struct LinkedListElement* element;
+	struct LinkedListElement* tail;
 	size_t dataSize;
 	size_t count;
+	int shared;
+	int (*compar)(const void*, const void*);
+	struct LinkedListLane* lanes;
+	size_t laneCapacity;
+	size_t laneCount;
+	size_t laneStride;
+	int concurrent;
+	ListOrganisation organisation;
+	EpochLimbo limbo;
+	ListAllocator allocator;
+	const ListStorage* storage;
+	void* storageData;
+	void* itemCopies;
+	size_t itemCopiesSize;
+	struct LinkedList* nextDestroyed;
 } LinkedList;
 
 typedef struct LinkedListElement
 {
 	void* data;
 	struct LinkedListElement* next;
+	size_t references;
+	struct LinkedListRegion* region;
+	size_t hits;
 } LinkedListElement;
 
+/*
+ * ListCompact moves elements, each followed by its item, into regions in list
+ * order. A region is freed with its last element; clones can free elements of
+ * the same region, so the number of live elements is kept atomically.
+ */
+typedef struct LinkedListRegion
+{
+	size_t liveCount;
+	size_t size;
+} LinkedListRegion;
+
+typedef struct LinkedListLane
+{
+	LinkedListElement* element;
+	size_t index;
+} LinkedListLane;
+
+static void SetCount(LinkedList* list, size_t count)
+{
+	__atomic_store_n(&list->count, count, __ATOMIC_RELAXED);
+}
+
 static void IncreaseCount(LinkedList* list)
 {
-	list->count++;
+	SetCount(list, list->count + 1);
 }
 
 static void DecreaseCount(LinkedList* list)
 {
-	list->count--;
+	SetCount(list, list->count - 1);
+}
+
+static void DecreaseCountBy(LinkedList* list, size_t amount)
+{
+	SetCount(list, list->count - amount);
 }
 
 static void ClearCount(LinkedList* list)
 {
-	list->count = 0;
+	SetCount(list, 0);
+}
+
+/*
+ * Links are published with release stores and followed with acquire loads,
+ * so readers of a concurrent list always see initialised elements.
+ */
+static void SetLink(struct LinkedListElement** link, struct LinkedListElement* element)
+{
+	__atomic_store_n(link, element, __ATOMIC_RELEASE);
+}
+
+static struct LinkedListElement* GetLink(struct LinkedListElement** link)
+{
+	return __atomic_load_n(link, __ATOMIC_ACQUIRE);
+}
+
+static void* AllocateMemory(void* ctx, size_t size)
+{
+	(void)ctx;
+
+	return malloc(size);
+}
+
+static void FreeMemory(void* ctx, void* pointer, size_t size)
+{
+	(void)ctx;
+	(void)size;
+
+	free(pointer);
+}
+
+static const ListAllocator defaultAllocator = { AllocateMemory, FreeMemory, NULL };
+
+static void SetUpList(LinkedList* list, size_t dataSize, const ListAllocator* allocator)
+{
+	list->allocator = *allocator;
+
+	list->element = NULL;
+	list->tail = NULL;
+	list->dataSize = dataSize;
+	list->shared = 0;
+	list->compar = NULL;
+	list->lanes = NULL;
+	list->laneCapacity = 0;
+	list->laneCount = 0;
+	list->laneStride = 0;
+	list->concurrent = 0;
+	list->organisation = LIST_ORGANISATION_NONE;
+	list->storage = NULL;
+	list->storageData = NULL;
+	list->itemCopies = NULL;
+	list->itemCopiesSize = 0;
+	list->nextDestroyed = NULL;
+	EpochLimboInitialise(&list->limbo);
+	ClearCount(list);
 }
 
 LinkedList* ListInitialise(size_t dataSize)
 {
+	TRACE_OPERATION(ListInitialise, NULL);
+
+	return ListInitialiseWithAllocator(dataSize, &defaultAllocator);
+}
+
+LinkedList* ListInitialiseWithAllocator(size_t dataSize, const ListAllocator* allocator)
+{
+	TRACE_OPERATION(ListInitialiseWithAllocator, NULL);
+
 	if (dataSize == 0)
 	{
 		return NULL;
 	}
+	if (allocator == NULL || allocator->alloc == NULL || allocator->free == NULL)
+	{
+		return NULL;
+	}
 
-	LinkedList* list = malloc(sizeof(LinkedList));
+	LinkedList* list = allocator->alloc(allocator->ctx, sizeof(LinkedList));
 
 	if (list == NULL)
 	{
 		return NULL;
 	}
 
-	list->element = NULL;
-	list->dataSize = dataSize;
-	ClearCount(list);
+	SetUpList(list, dataSize, allocator);
 
 	return list;
 }
 
-int ListDestroy(LinkedList** list)
+LinkedList* ListInitialiseCacheAligned(size_t dataSize)
 {
-	if (list == NULL)
+	if (dataSize == 0)
 	{
-		return ERROR_LIST_NULL;
+		return NULL;
 	}
 
-	ListClear(*list);
-	free(*list);
-	*list = NULL;
+	size_t size = (sizeof(LinkedList) + LIST_CACHE_LINE - 1) / LIST_CACHE_LINE * LIST_CACHE_LINE;
+	LinkedList* list = aligned_alloc(LIST_CACHE_LINE, size);
 
-	return 0;
-}
+	if (list == NULL)
+	{
+		return NULL;
+	}
 
-static void FreeElement(LinkedListElement** element)
-{
-	free((*element)->data);
-	(*element)->data = NULL;
+	// The default allocator frees with free, which also takes aligned_alloc memory.
+	SetUpList(list, dataSize, &defaultAllocator);
 
-	free(*element);
-	*element = NULL;
+	return list;
 }
 
-static LinkedListElement* CreateElement(LinkedList* list, void* item)
+LinkedList* ListInitialiseSorted(size_t dataSize, int (*compar)(const void*, const void*))
 {
-	LinkedListElement* element = malloc(sizeof(LinkedListElement));
+	TRACE_OPERATION(ListInitialiseSorted, NULL);
 
-	if (element == NULL)
+	if (compar == NULL)
 	{
 		return NULL;
 	}
 
-	element->data = malloc(list->dataSize);
-	element->next = NULL;
+	LinkedList* list = ListInitialise(dataSize);
 
-	if (element->data == NULL)
+	if (list == NULL)
 	{
-		free(element);
-		element = NULL;
-
 		return NULL;
 	}
 
-	memcpy(element->data, item, list->dataSize);
+	list->compar = compar;
 
-	return element;
+	return list;
 }
 
-static LinkedListElement* GetElement(LinkedList* list, size_t index)
+LinkedList* ListInitialiseConcurrent(size_t dataSize)
 {
-	LinkedListElement* element = list->element;
+	TRACE_OPERATION(ListInitialiseConcurrent, NULL);
 
-	for (size_t i = 0; i < index; i++)
+	LinkedList* list = ListInitialise(dataSize);
+
+	if (list == NULL)
 	{
-		element = element->next;
+		return NULL;
 	}
 
-	return element;
+	list->concurrent = 1;
+
+	return list;
 }
 
-static ssize_t GetIndex(LinkedList* list, void* item, int (*compar)(const void*, const void*))
+LinkedList* ListInitialiseSelfOrganising(size_t dataSize, ListOrganisation organisation)
 {
-	LinkedListElement* element = list->element;
+	TRACE_OPERATION(ListInitialiseSelfOrganising, NULL);
 
-	size_t index = 0;
+	if (organisation != LIST_ORGANISATION_MOVE_TO_FRONT && organisation != LIST_ORGANISATION_TRANSPOSE &&
+		organisation != LIST_ORGANISATION_FREQUENCY)
+	{
+		return NULL;
+	}
 
-	while (element != NULL)
+	LinkedList* list = ListInitialise(dataSize);
+
+	if (list == NULL)
+	{
+		return NULL;
+	}
+
+	list->organisation = organisation;
+
+	return list;
+}
+
+static LinkedList* InitialiseStorage(size_t dataSize, const ListStorage* storage, void* storageData)
+{
+	LinkedList* list = ListInitialise(dataSize);
+
+	if (list == NULL || storageData == NULL)
 	{
-		if (compar(element->data, item) == 0)
+		if (storageData != NULL)
 		{
-			return index;
+			storage->destroy(storageData);
 		}
 
-		element = element->next;
-		index++;
+		ListDestroy(&list);
+
+		return NULL;
 	}
 
-	return ERROR_INVALID_ITEM;
+	list->storage = storage;
+	list->storageData = storageData;
+
+	return list;
 }
 
-size_t ListCount(LinkedList* list)
+LinkedList* ListInitialiseDeque(size_t dataSize)
 {
-	if (list == NULL)
+	TRACE_OPERATION(ListInitialiseDeque, NULL);
+
+	if (dataSize == 0)
 	{
-		return ERROR_LIST_NULL;
+		return NULL;
 	}
 
-	return list->count;
+	return InitialiseStorage(dataSize, &ListDequeStorage, ListDequeCreate(dataSize, &defaultAllocator));
 }
 
-int ListPushFront(LinkedList* list, void* item)
+LinkedList* ListInitialiseRing(size_t dataSize, size_t capacity)
 {
-	if (list == NULL)
-	{
-		return ERROR_LIST_NULL;
-	}
-	if (item == NULL)
+	TRACE_OPERATION(ListInitialiseRing, NULL);
+
+	if (dataSize == 0 || capacity == 0)
 	{
-		return ERROR_ITEM_NULL;
+		return NULL;
 	}
 
-	LinkedListElement* beginElement = list->element;
-	LinkedListElement* newElement = CreateElement(list, item);
+	return InitialiseStorage(dataSize, &ListRingStorage, ListRingCreate(dataSize, capacity, &defaultAllocator));
+}
 
-	if (newElement == NULL)
+LinkedList* ListInitialiseCompact(size_t dataSize)
+{
+	TRACE_OPERATION(ListInitialiseCompact, NULL);
+
+	if (dataSize == 0)
 	{
-		return ERROR_ELEMENT_NULL;
+		return NULL;
 	}
 
-	if (beginElement == NULL)
+	return InitialiseStorage(dataSize, &ListSlabStorage, ListSlabCreate(dataSize, &defaultAllocator));
+}
+
+LinkedList* ListInitialiseTiered(size_t dataSize, const char* path, size_t memoryBudget)
+{
+	TRACE_OPERATION(ListInitialiseTiered, NULL);
+
+	if (dataSize == 0 || path == NULL)
 	{
-		list->element = newElement;
+		return NULL;
 	}
-	else
+
+	return InitialiseStorage(dataSize, &ListTieredStorage,
+		ListTieredCreate(dataSize, path, memoryBudget, &defaultAllocator));
+}
+
+LinkedList* ListInitialiseCompressed(size_t dataSize)
+{
+	TRACE_OPERATION(ListInitialiseCompressed, NULL);
+
+	if (dataSize != sizeof(uint32_t) && dataSize != sizeof(uint64_t))
 	{
-		list->element = newElement;
-		newElement->next = beginElement;
+		return NULL;
 	}
 
-	IncreaseCount(list);
-
-	return 0;
+	return InitialiseStorage(dataSize, &ListCompressedStorage, ListCompressedCreate(dataSize, &defaultAllocator));
 }
 
-int ListPushBack(LinkedList* list, void* item)
+int ListDestroy(LinkedList** list)
 {
+	TRACE_OPERATION(ListDestroy, list != NULL ? *list : NULL);
+
 	if (list == NULL)
 	{
 		return ERROR_LIST_NULL;
 	}
-	if (item == NULL)
-	{
-		return ERROR_ITEM_NULL;
-	}
 
-	if (ListCount(list) == 0)
+	if (*list == NULL)
 	{
-		ListPushFront(list, item);
-
 		return 0;
 	}
 
-	LinkedListElement* lastElement = GetElement(list, ListCount(list) - 1);
-	LinkedListElement* newElement = CreateElement(list, item);
+	ListAllocator allocator = (*list)->allocator;
 
-	if (newElement == NULL)
+	if ((*list)->storage != NULL)
 	{
-		return ERROR_ELEMENT_NULL;
+		(*list)->storage->destroy((*list)->storageData);
+	}
+	else
+	{
+		ListClear(*list);
+	}
+
+	if ((*list)->itemCopies != NULL)
+	{
+		allocator.free(allocator.ctx, (*list)->itemCopies, (*list)->itemCopiesSize);
 	}
 
-	lastElement->next = newElement;
+	if ((*list)->lanes != NULL)
+	{
+		allocator.free(allocator.ctx, (*list)->lanes, (*list)->laneCapacity * sizeof(LinkedListLane));
+	}
 
-	IncreaseCount(list);
+	EpochLimboDestroy(&(*list)->limbo);
+	allocator.free(allocator.ctx, *list, sizeof(LinkedList));
+	*list = NULL;
 
 	return 0;
 }
 
-int ListPushAt(LinkedList* list, size_t index, void* item)
+/*
+ * Lists handed to ListDestroyAsync are pushed onto a stack that a single
+ * detached thread, started on first use, drains with ListDestroy.
+ */
+static pthread_once_t reclaimerOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t reclaimerLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t reclaimerSignal = PTHREAD_COND_INITIALIZER;
+static LinkedList* destroyedLists = NULL;
+static int reclaimerStarted = 0;
+
+static void* RunReclaimer(void* argument)
 {
-	if (list == NULL)
-	{
-		return ERROR_LIST_NULL;
-	}
-	if (index > ListCount(list))
-	{
-		return ERROR_INVALID_INDEX;
-	}
-	if (item == NULL)
-	{
-		return ERROR_ITEM_NULL;
-	}
+	(void)argument;
 
-	if (index == 0)
+	while (1)
 	{
-		ListPushFront(list, item);
+		pthread_mutex_lock(&reclaimerLock);
 
-		return 0;
-	}
-	if (index == ListCount(list))
-	{
-		ListPushBack(list, item);
+		while (destroyedLists == NULL)
+		{
+			pthread_cond_wait(&reclaimerSignal, &reclaimerLock);
+		}
 
-		return 0;
-	}
+		LinkedList* list = destroyedLists;
+		destroyedLists = NULL;
 
-	LinkedListElement* middleElement = GetElement(list, index - 1);
-	LinkedListElement* nextElement = middleElement->next;
-	LinkedListElement* newElement = CreateElement(list, item);
+		pthread_mutex_unlock(&reclaimerLock);
 
-	if (newElement == NULL)
-	{
-		return ERROR_ELEMENT_NULL;
+		while (list != NULL)
+		{
+			LinkedList* nextList = list->nextDestroyed;
+
+			ListDestroy(&list);
+			list = nextList;
+		}
 	}
 
-	middleElement->next = newElement;
-	newElement->next = nextElement;
+	return NULL;
+}
 
-	IncreaseCount(list);
+static void StartReclaimer(void)
+{
+	pthread_t thread;
 
-	return 0;
+	if (pthread_create(&thread, NULL, RunReclaimer, NULL) == 0)
+	{
+		pthread_detach(thread);
+		reclaimerStarted = 1;
+	}
 }
 
-int ListPopFront(LinkedList* list)
+int ListDestroyAsync(LinkedList** list)
 {
+	TRACE_OPERATION(ListDestroyAsync, list != NULL ? *list : NULL);
+
 	if (list == NULL)
 	{
 		return ERROR_LIST_NULL;
 	}
-	if (ListCount(list) == 0)
+
+	if (*list == NULL)
 	{
-		return ERROR_LIST_EMPTY;
+		return 0;
 	}
 
-	LinkedListElement* remainingElements = list->element->next;
+	pthread_once(&reclaimerOnce, StartReclaimer);
 
-	FreeElement(&list->element);
-
-	if (remainingElements != NULL)
+	if (!reclaimerStarted)
 	{
-		list->element = remainingElements;
+		return ListDestroy(list);
 	}
 
-	DecreaseCount(list);
+	pthread_mutex_lock(&reclaimerLock);
+	(*list)->nextDestroyed = destroyedLists;
+	destroyedLists = *list;
+	pthread_cond_signal(&reclaimerSignal);
+	pthread_mutex_unlock(&reclaimerLock);
+
+	*list = NULL;
 
 	return 0;
 }
 
-int ListPopBack(LinkedList* list)
+static void FreeData(void* ctx, void* data)
 {
-	if (list == NULL)
+	LinkedList* list = ctx;
+
+	list->allocator.free(list->allocator.ctx, data, list->dataSize);
+}
+
+static void DestroyElement(void* ctx, void* element)
+{
+	LinkedList* list = ctx;
+
+	FreeData(list, ((LinkedListElement*)element)->data);
+	list->allocator.free(list->allocator.ctx, element, sizeof(LinkedListElement));
+}
+
+static void ReleaseRegion(LinkedList* list, LinkedListRegion* region)
+{
+	if (__atomic_sub_fetch(&region->liveCount, 1, __ATOMIC_ACQ_REL) == 0)
 	{
-		return ERROR_LIST_NULL;
+		list->allocator.free(list->allocator.ctx, region, region->size);
 	}
-	if (ListCount(list) == 0)
+}
+
+static void FreeElement(LinkedList* list, LinkedListElement** element)
+{
+	if (list->concurrent)
 	{
-		return ERROR_LIST_EMPTY;
+		EpochRetire(&list->limbo, *element, DestroyElement, list);
+		*element = NULL;
+
+		return;
 	}
 
-	if (ListCount(list) == 1)
+	if ((*element)->region != NULL)
 	{
-		ListPopFront(list);
+		ReleaseRegion(list, (*element)->region);
+		*element = NULL;
 
-		return 0;
+		return;
 	}
 
-	LinkedListElement* secondLastElement = GetElement(list, ListCount(list) - 2);
-
-	FreeElement(&secondLastElement->next);
-	DecreaseCount(list);
+	FreeData(list, (*element)->data);
+	(*element)->data = NULL;
 
-	return 0;
+	list->allocator.free(list->allocator.ctx, *element, sizeof(LinkedListElement));
+	*element = NULL;
 }
 
-int ListPopAt(LinkedList* list, size_t index)
+static void FreeElements(LinkedList* list, LinkedListElement* element)
 {
-	if (list == NULL)
-	{
-		return ERROR_LIST_NULL;
-	}
-	if (ListCount(list) == 0)
-	{
-		return ERROR_LIST_EMPTY;
-	}
-	if (index >= ListCount(list))
+	while (element != NULL)
 	{
-		return ERROR_INVALID_INDEX;
-	}
+		LinkedListElement* nextElement = element->next;
+
+		FreeElement(list, &element);
+		element = nextElement;
+	}
+}
+
+/*
+ * Elements are shared between a list and its clones. The reference count is
+ * the number of links (list heads or next pointers) that point at an element.
+ * An element with a single reference is only reachable by one owner, so no
+ * other list can race with it and the atomic decrement can be skipped.
+ */
+static void RetainElement(LinkedListElement* element)
+{
+	__atomic_add_fetch(&element->references, 1, __ATOMIC_RELAXED);
+}
+
+static int IsElementShared(LinkedListElement* element)
+{
+	return __atomic_load_n(&element->references, __ATOMIC_ACQUIRE) > 1;
+}
+
+static int ReleaseElement(LinkedListElement* element)
+{
+	if (!IsElementShared(element))
+	{
+		return 1;
+	}
+
+	return __atomic_sub_fetch(&element->references, 1, __ATOMIC_ACQ_REL) == 0;
+}
+
+static void ReleaseElements(LinkedList* list, LinkedListElement* element)
+{
+	while (element != NULL && ReleaseElement(element))
+	{
+		LinkedListElement* nextElement = element->next;
+
+		FreeElement(list, &element);
+		element = nextElement;
+	}
+}
+
+static void UnlinkElement(LinkedList* list, LinkedListElement** link)
+{
+	LinkedListElement* element = *link;
+
+	if (element == list->tail)
+	{
+		list->tail = NULL;
+	}
+
+	SetLink(link, element->next);
+
+	if (!IsElementShared(element))
+	{
+		FreeElement(list, &element);
+
+		return;
+	}
+
+	if (*link != NULL)
+	{
+		RetainElement(*link);
+	}
+
+	ReleaseElements(list, element);
+}
+
+static LinkedListElement* CreateElement(LinkedList* list, void* item)
+{
+	LinkedListElement* element = list->allocator.alloc(list->allocator.ctx, sizeof(LinkedListElement));
+
+	if (element == NULL)
+	{
+		return NULL;
+	}
+
+	element->data = list->allocator.alloc(list->allocator.ctx, list->dataSize);
+	element->next = NULL;
+	element->references = 1;
+	element->region = NULL;
+	element->hits = 0;
+
+	if (element->data == NULL)
+	{
+		list->allocator.free(list->allocator.ctx, element, sizeof(LinkedListElement));
+		element = NULL;
+
+		return NULL;
+	}
+
+	memcpy(element->data, item, list->dataSize);
+
+	return element;
+}
+
+static void* GetData(LinkedListElement* element)
+{
+	return __atomic_load_n(&element->data, __ATOMIC_ACQUIRE);
+}
+
+static LinkedListElement* GetElement(LinkedList* list, size_t index)
+{
+	LinkedListElement* element = GetLink(&list->element);
+
+	for (size_t i = 0; i < index && element != NULL; i++)
+	{
+		element = GetLink(&element->next);
+	}
+
+	TRACE_STEPS(index);
+
+	return element;
+}
+
+/*
+ * The last element is cached once it has been looked up. Unlinking or
+ * copying it resets the cache and appending behind it moves the cache on.
+ */
+static LinkedListElement* GetTail(LinkedList* list)
+{
+	if (list->tail == NULL && ListCount(list) > 0)
+	{
+		list->tail = GetElement(list, ListCount(list) - 1);
+	}
+
+	return list->tail;
+}
+
+static int IsSorted(LinkedList* list)
+{
+	return list->compar != NULL;
+}
+
+static void InvalidateLanes(LinkedList* list)
+{
+	list->laneCount = 0;
+	list->laneStride = 0;
+}
+
+/*
+ * The express lanes of a sorted list hold every laneStride-th element and its
+ * index, so a search can binary search the lanes and only walk one gap.
+ */
+static void BuildLanes(LinkedList* list)
+{
+	size_t stride = LANE_MINIMUM_STRIDE;
+
+	while ((stride + 1) * (stride + 1) <= ListCount(list))
+	{
+		stride++;
+	}
+
+	size_t laneCount = ListCount(list) / stride;
+
+	if (laneCount + 1 > list->laneCapacity)
+	{
+		LinkedListLane* lanes = list->allocator.alloc(list->allocator.ctx, (laneCount + 1) * sizeof(LinkedListLane));
+
+		if (lanes == NULL)
+		{
+			InvalidateLanes(list);
+
+			return;
+		}
+
+		if (list->lanes != NULL)
+		{
+			list->allocator.free(list->allocator.ctx, list->lanes, list->laneCapacity * sizeof(LinkedListLane));
+		}
+
+		list->lanes = lanes;
+		list->laneCapacity = laneCount + 1;
+	}
+
+	LinkedListLane* lanes = list->lanes;
+	LinkedListElement* element = list->element;
+
+	for (size_t i = 0; i < laneCount; i++)
+	{
+		lanes[i].element = element;
+		lanes[i].index = i * stride;
+
+		for (size_t j = 0; j < stride; j++)
+		{
+			element = element->next;
+		}
+	}
+
+	list->laneCount = laneCount;
+	list->laneStride = stride;
+}
+
+static int AreLanesBalanced(LinkedList* list)
+{
+	size_t stride = list->laneStride;
+
+	if (stride == 0)
+	{
+		return 0;
+	}
+	if (ListCount(list) >= 4 * stride * stride)
+	{
+		return 0;
+	}
+	if (stride > LANE_MINIMUM_STRIDE && ListCount(list) < stride * stride / 4)
+	{
+		return 0;
+	}
+
+	size_t laneEnd = list->laneCount > 0 ? list->lanes[list->laneCount - 1].index : 0;
+
+	return ListCount(list) - laneEnd <= 2 * stride;
+}
+
+/*
+ * Inserts and removals that cluster between two lanes widen that one gap
+ * without changing the totals AreLanesBalanced looks at, so the gap around
+ * every change is checked too. Once it spans more than two strides the lanes
+ * are dropped and rebuilt by the next sorted operation.
+ */
+static void CheckLaneGap(LinkedList* list, size_t gapStart, size_t gapEnd)
+{
+	if (gapEnd - gapStart > 2 * list->laneStride)
+	{
+		InvalidateLanes(list);
+	}
+}
+
+static void InsertLane(LinkedList* list, size_t index)
+{
+	size_t gapStart = 0;
+	size_t gapEnd = ListCount(list) + 1;
+
+	for (size_t i = 0; i < list->laneCount; i++)
+	{
+		if (list->lanes[i].index >= index)
+		{
+			list->lanes[i].index++;
+			gapEnd = list->lanes[i].index < gapEnd ? list->lanes[i].index : gapEnd;
+		}
+		else
+		{
+			gapStart = list->lanes[i].index;
+		}
+	}
+
+	CheckLaneGap(list, gapStart, gapEnd);
+}
+
+static void RemoveLanes(LinkedList* list, size_t index, size_t count)
+{
+	size_t keptCount = 0;
+	size_t gapStart = 0;
+	size_t gapEnd = ListCount(list) - count;
+
+	for (size_t i = 0; i < list->laneCount; i++)
+	{
+		LinkedListLane lane = list->lanes[i];
+
+		if (lane.index >= index + count)
+		{
+			lane.index -= count;
+			gapEnd = lane.index < gapEnd ? lane.index : gapEnd;
+		}
+		else if (lane.index >= index)
+		{
+			continue;
+		}
+		else
+		{
+			gapStart = lane.index;
+		}
+
+		list->lanes[keptCount++] = lane;
+	}
+
+	list->laneCount = keptCount;
+
+	CheckLaneGap(list, gapStart, gapEnd);
+}
+
+static LinkedListElement* FindLowerBound(LinkedList* list, void* item, LinkedListElement** previousElement, size_t* index)
+{
+	LinkedListElement* leftElement = NULL;
+	LinkedListElement* element = list->element;
+	size_t elementIndex = 0;
+
+	size_t low = 0;
+	size_t high = list->laneCount;
+
+	while (low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+
+		if (list->compar(list->lanes[middle].element->data, item) < 0)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	if (low > 0)
+	{
+		leftElement = list->lanes[low - 1].element;
+		element = leftElement->next;
+		elementIndex = list->lanes[low - 1].index + 1;
+	}
+
+	while (element != NULL && list->compar(element->data, item) < 0)
+	{
+		leftElement = element;
+		element = element->next;
+		elementIndex++;
+		TRACE_STEPS(1);
+	}
+
+	*previousElement = leftElement;
+	*index = elementIndex;
+
+	return element;
+}
+
+static LinkedListElement* CopyElement(LinkedList* list, LinkedListElement* element)
+{
+	LinkedListElement* copyElement = CreateElement(list, element->data);
+
+	if (copyElement == NULL)
+	{
+		return NULL;
+	}
+
+	copyElement->next = element->next;
+	copyElement->hits = element->hits;
+
+	if (copyElement->next != NULL)
+	{
+		RetainElement(copyElement->next);
+	}
+
+	ReleaseElements(list, element);
+
+	return copyElement;
+}
+
+/*
+ * Walks to the element at index, copying every shared element up to last so
+ * the caller may modify them without the change showing up in a clone.
+ * Returns NULL when a copy could not be allocated.
+ */
+static LinkedListElement* GetExclusiveRange(LinkedList* list, size_t index, size_t last)
+{
+	if (!list->shared)
+	{
+		return GetElement(list, index);
+	}
+
+	LinkedListElement** link = &list->element;
+	LinkedListElement* indexElement = NULL;
+
+	for (size_t i = 0; i <= last; i++)
+	{
+		LinkedListElement* element = *link;
+
+		if (IsElementShared(element))
+		{
+			element = CopyElement(list, element);
+
+			if (element == NULL)
+			{
+				return NULL;
+			}
+
+			SetLink(link, element);
+			InvalidateLanes(list);
+			list->tail = NULL;
+		}
+
+		if (i == index)
+		{
+			indexElement = element;
+		}
+
+		link = &element->next;
+	}
+
+	TRACE_STEPS(last + 1);
+
+	if (last == ListCount(list) - 1)
+	{
+		list->shared = 0;
+	}
+
+	return indexElement;
+}
+
+static LinkedListElement* GetExclusiveElement(LinkedList* list, size_t index)
+{
+	return GetExclusiveRange(list, index, index);
+}
+
+static int ReplaceData(LinkedList* list, LinkedListElement* element, const void* item)
+{
+	if (!list->concurrent)
+	{
+		memcpy(element->data, item, list->dataSize);
+
+		return 0;
+	}
+
+	void* data = list->allocator.alloc(list->allocator.ctx, list->dataSize);
+
+	if (data == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	void* replacedData = element->data;
+
+	memcpy(data, item, list->dataSize);
+	__atomic_store_n(&element->data, data, __ATOMIC_RELEASE);
+	EpochRetire(&list->limbo, replacedData, FreeData, list);
+
+	return 0;
+}
+
+static ssize_t GetStoredIndex(LinkedList* list, void* item, int (*compar)(const void*, const void*))
+{
+	size_t count = ListCount(list);
+
+	for (size_t index = 0; index < count; index++)
+	{
+		TRACE_STEPS(1);
+
+		if (compar(list->storage->getItem(list->storageData, index), item) == 0)
+		{
+			return index;
+		}
+	}
+
+	return ERROR_INVALID_ITEM;
+}
+
+static ssize_t GetIndex(LinkedList* list, void* item, int (*compar)(const void*, const void*))
+{
+	if (list->storage != NULL)
+	{
+		return GetStoredIndex(list, item, compar);
+	}
+
+	LinkedListElement* element = GetLink(&list->element);
+
+	size_t index = 0;
+
+	while (element != NULL)
+	{
+		TRACE_STEPS(1);
+
+		if (compar(GetData(element), item) == 0)
+		{
+			return index;
+		}
+
+		element = GetLink(&element->next);
+		index++;
+	}
+
+	return ERROR_INVALID_ITEM;
+}
+
+/*
+ * Moves the element found at index, whose link is given along with the link
+ * to its predecessor, towards the front of a self-organising list and
+ * returns its new index. Frequency lists are kept ordered by hit count, so
+ * the element moves in front of the first element hit less often than it.
+ */
+static size_t OrganiseElement(LinkedList* list, LinkedListElement** previousLink, LinkedListElement** link, size_t index)
+{
+	LinkedListElement* element = *link;
+	LinkedListElement** insertLink = &list->element;
+	size_t insertIndex = 0;
+
+	if (list->organisation == LIST_ORGANISATION_TRANSPOSE)
+	{
+		insertLink = previousLink;
+		insertIndex = index - 1;
+	}
+	else if (list->organisation == LIST_ORGANISATION_FREQUENCY)
+	{
+		element->hits++;
+
+		while (*insertLink != element && (*insertLink)->hits >= element->hits)
+		{
+			insertLink = &(*insertLink)->next;
+			insertIndex++;
+		}
+
+		TRACE_STEPS(insertIndex);
+
+		if (*insertLink == element)
+		{
+			return index;
+		}
+	}
+
+	if (element == list->tail)
+	{
+		list->tail = NULL;
+	}
+
+	*link = element->next;
+	element->next = *insertLink;
+	*insertLink = element;
+
+	return insertIndex;
+}
+
+static ssize_t GetOrganisedIndex(LinkedList* list, void* item, int (*compar)(const void*, const void*))
+{
+	LinkedListElement** previousLink = NULL;
+	LinkedListElement** link = &list->element;
+	size_t index = 0;
+
+	while (*link != NULL && compar((*link)->data, item) != 0)
+	{
+		TRACE_STEPS(1);
+
+		previousLink = link;
+		link = &(*link)->next;
+		index++;
+	}
+
+	if (*link == NULL)
+	{
+		return ERROR_INVALID_ITEM;
+	}
+	if (index == 0 && list->organisation != LIST_ORGANISATION_FREQUENCY)
+	{
+		return 0;
+	}
+
+	/* Elements shared with a clone are copied before they are relinked, which leaves the links found stale. */
+	if (list->shared)
+	{
+		if (GetExclusiveRange(list, 0, index) == NULL)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		previousLink = NULL;
+		link = &list->element;
+
+		for (size_t i = 0; i < index; i++)
+		{
+			previousLink = link;
+			link = &(*link)->next;
+		}
+	}
+
+	return OrganiseElement(list, previousLink, link, index);
+}
+
+/*
+ * Keeps the first count items. Backends that cannot pop from the back in
+ * constant time drop the rest in one pass.
+ */
+static int TruncateStoredItems(LinkedList* list, size_t count)
+{
+	if (list->storage->truncate != NULL)
+	{
+		return list->storage->truncate(list->storageData, count);
+	}
+
+	while (ListCount(list) > count)
+	{
+		int result = list->storage->popBack(list->storageData);
+
+		if (result != 0)
+		{
+			return result;
+		}
+	}
+
+	return 0;
+}
+
+static ssize_t RemoveStoredItems(LinkedList* list, int (*predicate)(const void*, void*), void* ctx, int removeOnMatch)
+{
+	size_t count = ListCount(list);
+	size_t keptCount = 0;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		void* item = list->storage->getItem(list->storageData, i);
+		int match = predicate(item, ctx) != 0;
+
+		if (match == removeOnMatch)
+		{
+			continue;
+		}
+		if (keptCount != i)
+		{
+			int result = list->storage->replace(list->storageData, keptCount, item);
+
+			if (result != 0)
+			{
+				return result;
+			}
+		}
+
+		keptCount++;
+	}
+
+	int result = TruncateStoredItems(list, keptCount);
+
+	if (result != 0)
+	{
+		return result;
+	}
+
+	return count - keptCount;
+}
+
+static ssize_t RemoveElements(LinkedList* list, int (*predicate)(const void*, void*), void* ctx, int removeOnMatch)
+{
+	if (list->storage != NULL)
+	{
+		return RemoveStoredItems(list, predicate, ctx, removeOnMatch);
+	}
+
+	if (GetExclusiveElement(list, ListCount(list) - 1) == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	LinkedListElement** link = &list->element;
+	LinkedListElement* removedElements = NULL;
+	size_t removedCount = 0;
+
+	while (*link != NULL)
+	{
+		LinkedListElement* element = *link;
+		int match = predicate(element->data, ctx) != 0;
+
+		if (match == removeOnMatch)
+		{
+			SetLink(link, element->next);
+			removedCount++;
+
+			if (list->concurrent)
+			{
+				FreeElement(list, &element);
+			}
+			else
+			{
+				element->next = removedElements;
+				removedElements = element;
+			}
+		}
+		else
+		{
+			link = &element->next;
+		}
+	}
+
+	FreeElements(list, removedElements);
+	InvalidateLanes(list);
+	list->tail = NULL;
+	DecreaseCountBy(list, removedCount);
+
+	return removedCount;
+}
+
+size_t ListCount(LinkedList* list)
+{
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	if (list->storage != NULL)
+	{
+		return list->storage->count(list->storageData);
+	}
+
+	return __atomic_load_n(&list->count, __ATOMIC_RELAXED);
+}
+
+int ListPushFront(LinkedList* list, void* item)
+{
+	TRACE_OPERATION(ListPushFront, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (IsSorted(list))
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	if (list->storage != NULL)
+	{
+		return list->storage->pushFront(list->storageData, item);
+	}
+
+	LinkedListElement* beginElement = list->element;
+	LinkedListElement* newElement = CreateElement(list, item);
+
+	if (newElement == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	newElement->next = beginElement;
+	SetLink(&list->element, newElement);
+
+	if (beginElement == NULL)
+	{
+		list->tail = newElement;
+	}
+
+	IncreaseCount(list);
+
+	return 0;
+}
+
+int ListPushBack(LinkedList* list, void* item)
+{
+	TRACE_OPERATION(ListPushBack, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (IsSorted(list))
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	if (list->storage != NULL)
+	{
+		return list->storage->pushBack(list->storageData, item);
+	}
+
+	if (ListCount(list) == 0)
+	{
+		ListPushFront(list, item);
+
+		return 0;
+	}
+
+	LinkedListElement* lastElement = list->shared ? GetExclusiveElement(list, ListCount(list) - 1) : GetTail(list);
+	LinkedListElement* newElement = lastElement != NULL ? CreateElement(list, item) : NULL;
+
+	if (newElement == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	SetLink(&lastElement->next, newElement);
+	list->tail = newElement;
+
+	IncreaseCount(list);
+
+	return 0;
+}
+
+int ListPushAt(LinkedList* list, size_t index, void* item)
+{
+	TRACE_OPERATION(ListPushAt, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (IsSorted(list))
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (index > ListCount(list))
+	{
+		return ERROR_INVALID_INDEX;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	if (list->storage != NULL)
+	{
+		return list->storage->pushAt(list->storageData, index, item);
+	}
+
+	if (index == 0)
+	{
+		ListPushFront(list, item);
+
+		return 0;
+	}
+	if (index == ListCount(list))
+	{
+		ListPushBack(list, item);
+
+		return 0;
+	}
+
+	LinkedListElement* middleElement = GetExclusiveElement(list, index - 1);
+
+	if (middleElement == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	LinkedListElement* nextElement = middleElement->next;
+	LinkedListElement* newElement = CreateElement(list, item);
+
+	if (newElement == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	newElement->next = nextElement;
+	SetLink(&middleElement->next, newElement);
+
+	IncreaseCount(list);
+
+	return 0;
+}
+
+int ListPopFront(LinkedList* list)
+{
+	TRACE_OPERATION(ListPopFront, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	/* Batch pops report an empty list themselves, without the ring consumer reading the producer's index. */
+	if (list->storage != NULL && list->storage->popFrontMany != NULL)
+	{
+		return list->storage->popFrontMany(list->storageData, NULL, 1) == 1 ? 0 : ERROR_LIST_EMPTY;
+	}
+
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+
+	if (list->storage != NULL)
+	{
+		return list->storage->popFront(list->storageData);
+	}
+
+	UnlinkElement(list, &list->element);
+	RemoveLanes(list, 0, 1);
+	DecreaseCount(list);
+
+	return 0;
+}
+
+int ListPopBack(LinkedList* list)
+{
+	TRACE_OPERATION(ListPopBack, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+
+	if (list->storage != NULL)
+	{
+		return list->storage->popBack(list->storageData);
+	}
+
+	if (ListCount(list) == 1)
+	{
+		ListPopFront(list);
+
+		return 0;
+	}
+
+	LinkedListElement* secondLastElement = GetExclusiveElement(list, ListCount(list) - 2);
+
+	if (secondLastElement == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	UnlinkElement(list, &secondLastElement->next);
+	RemoveLanes(list, ListCount(list) - 1, 1);
+	DecreaseCount(list);
+
+	return 0;
+}
+
+int ListPopAt(LinkedList* list, size_t index)
+{
+	TRACE_OPERATION(ListPopAt, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (index >= ListCount(list))
+	{
+		return ERROR_INVALID_INDEX;
+	}
+
+	if (list->storage != NULL)
+	{
+		return list->storage->popAt(list->storageData, index);
+	}
 
 	if (index == 0)
 	{
-		ListPopFront(list);
+		ListPopFront(list);
+
+		return 0;
+	}
+	if (index == ListCount(list) - 1)
+	{
+		ListPopBack(list);
+
+		return 0;
+	}
+
+	LinkedListElement* leftFromRemoveElement = GetExclusiveElement(list, index - 1);
+
+	if (leftFromRemoveElement == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	UnlinkElement(list, &leftFromRemoveElement->next);
+	RemoveLanes(list, index, 1);
+	DecreaseCount(list);
+
+	return 0;
+}
+
+int ListReplace(LinkedList* list, size_t index, void* item)
+{
+	TRACE_OPERATION(ListReplace, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (IsSorted(list))
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (index >= ListCount(list))
+	{
+		return ERROR_INVALID_INDEX;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	if (list->storage != NULL)
+	{
+		return list->storage->replace(list->storageData, index, item);
+	}
+
+	LinkedListElement* replaceElement = GetExclusiveElement(list, index);
+
+	if (replaceElement == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	return ReplaceData(list, replaceElement, item);
+}
+
+int ListClear(LinkedList* list)
+{
+	TRACE_OPERATION(ListClear, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+
+	if (list->storage != NULL)
+	{
+		return list->storage->clear(list->storageData);
+	}
+
+	LinkedListElement* element = list->element;
+
+	SetLink(&list->element, NULL);
+	list->tail = NULL;
+	ReleaseElements(list, element);
+	InvalidateLanes(list);
+	ClearCount(list);
+
+	return 0;
+}
+
+int ListClearIncremental(LinkedList* list, size_t budget)
+{
+	TRACE_OPERATION(ListClearIncremental, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+
+	size_t count = ListCount(list) < budget ? ListCount(list) : budget;
+
+	if (list->storage != NULL)
+	{
+		return ListPopFrontMany(list, NULL, count, NULL);
+	}
+
+	for (size_t i = 0; i < count; i++)
+	{
+		UnlinkElement(list, &list->element);
+	}
+
+	RemoveLanes(list, 0, count);
+	DecreaseCountBy(list, count);
+
+	return 0;
+}
+
+int ListGetItem(LinkedList* list, size_t index, void** item)
+{
+	TRACE_OPERATION(ListGetItem, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (index >= ListCount(list))
+	{
+		return ERROR_INVALID_INDEX;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	if (list->storage != NULL)
+	{
+		*item = list->storage->getItem(list->storageData, index);
+
+		return *item != NULL ? 0 : ERROR_ELEMENT_NULL;
+	}
+
+	LinkedListElement* element = GetElement(list, index);
+
+	if (element == NULL)
+	{
+		return ERROR_INVALID_INDEX;
+	}
+
+	*item = GetData(element);
+
+	return 0;
+}
+
+typedef struct LinkedListRequest
+{
+	size_t index;
+	size_t position;
+} LinkedListRequest;
+
+static int CompareRequests(const void* requestOne, const void* requestTwo)
+{
+	size_t indexOne = ((const LinkedListRequest*)requestOne)->index;
+	size_t indexTwo = ((const LinkedListRequest*)requestTwo)->index;
+
+	return (indexOne > indexTwo) - (indexOne < indexTwo);
+}
+
+/*
+ * Backends with transient items may reuse an item's memory on the next
+ * access, so ListGetItems hands out copies that live until the next call.
+ */
+static int ReserveItemCopies(LinkedList* list, size_t count)
+{
+	size_t size = count * list->dataSize;
+
+	if (size <= list->itemCopiesSize)
+	{
+		return 0;
+	}
+
+	void* itemCopies = list->allocator.alloc(list->allocator.ctx, size);
+
+	if (itemCopies == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	if (list->itemCopies != NULL)
+	{
+		list->allocator.free(list->allocator.ctx, list->itemCopies, list->itemCopiesSize);
+	}
+
+	list->itemCopies = itemCopies;
+	list->itemCopiesSize = size;
+
+	return 0;
+}
+
+/*
+ * The requests are visited in index order, so the list is walked once no
+ * matter how the caller ordered the indices.
+ */
+int ListGetItems(LinkedList* list, const size_t* indices, size_t count, void** items)
+{
+	TRACE_OPERATION(ListGetItems, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (indices == NULL)
+	{
+		return ERROR_INDEX_NULL;
+	}
+	if (items == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	int ordered = 1;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		if (indices[i] >= ListCount(list))
+		{
+			return ERROR_INVALID_INDEX;
+		}
+
+		ordered &= i == 0 || indices[i - 1] <= indices[i];
+	}
+
+	if (list->storage != NULL && list->storage->transientItems && ReserveItemCopies(list, count) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	LinkedListRequest* requests = NULL;
+
+	if (!ordered)
+	{
+		requests = list->allocator.alloc(list->allocator.ctx, count * sizeof(LinkedListRequest));
+
+		if (requests == NULL)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		for (size_t i = 0; i < count; i++)
+		{
+			requests[i] = (LinkedListRequest) { indices[i], i };
+		}
+
+		qsort(requests, count, sizeof(LinkedListRequest), CompareRequests);
+	}
+
+	LinkedListElement* element = GetLink(&list->element);
+	size_t elementIndex = 0;
+	int result = 0;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		LinkedListRequest request = ordered ? (LinkedListRequest) { indices[i], i } : requests[i];
+
+		if (list->storage != NULL)
+		{
+			items[request.position] = list->storage->getItem(list->storageData, request.index);
+
+			if (items[request.position] == NULL)
+			{
+				result = ERROR_ELEMENT_NULL;
+
+				break;
+			}
+
+			if (list->storage->transientItems)
+			{
+				void* copy = (unsigned char*)list->itemCopies + request.position * list->dataSize;
+
+				memcpy(copy, items[request.position], list->dataSize);
+				items[request.position] = copy;
+			}
+
+			continue;
+		}
+
+		for (; elementIndex < request.index && element != NULL; elementIndex++)
+		{
+			element = GetLink(&element->next);
+			TRACE_STEPS(1);
+		}
+
+		if (element == NULL)
+		{
+			result = ERROR_INVALID_INDEX;
+
+			break;
+		}
+
+		items[request.position] = GetData(element);
+	}
+
+	if (requests != NULL)
+	{
+		list->allocator.free(list->allocator.ctx, requests, count * sizeof(LinkedListRequest));
+	}
+
+	return result;
+}
+
+int ListGetIndex(LinkedList* list, size_t* index, void* item, int (*compar)(const void*, const void*))
+{
+	TRACE_OPERATION(ListGetIndex, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (index == NULL)
+	{
+		return ERROR_INDEX_NULL;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	ssize_t itemIndex = list->organisation != LIST_ORGANISATION_NONE ? GetOrganisedIndex(list, item, compar) :
+		GetIndex(list, item, compar);
+
+	if (itemIndex < 0)
+	{
+		return itemIndex;
+	}
+
+	*index = itemIndex;
+
+	return 0;
+}
+
+int ListPushBackMany(LinkedList* list, const void* items, size_t count, size_t* pushedCount)
+{
+	TRACE_OPERATION(ListPushBackMany, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (items == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	size_t pushed = 0;
+	int result = 0;
+
+	if (list->storage != NULL && list->storage->pushBackMany != NULL)
+	{
+		pushed = list->storage->pushBackMany(list->storageData, items, count);
+		result = pushed == 0 && count > 0 ? ERROR_LIST_FULL : 0;
+	}
+	else
+	{
+		const char* item = items;
+
+		while (pushed < count && (result = ListPushBack(list, (void*)item)) == 0)
+		{
+			item += list->dataSize;
+			pushed++;
+		}
+
+		result = pushed == 0 ? result : 0;
+	}
+
+	if (pushedCount != NULL)
+	{
+		*pushedCount = pushed;
+	}
+
+	return result;
+}
+
+int ListPopFrontMany(LinkedList* list, void* items, size_t count, size_t* poppedCount)
+{
+	TRACE_OPERATION(ListPopFrontMany, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	size_t popped = 0;
+
+	if (list->storage != NULL && list->storage->popFrontMany != NULL && count > 0)
+	{
+		popped = list->storage->popFrontMany(list->storageData, items, count);
+
+		if (popped == 0)
+		{
+			return ERROR_LIST_EMPTY;
+		}
+	}
+	else if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	else
+	{
+		char* item = items;
+
+		while (popped < count && ListCount(list) > 0)
+		{
+			if (item != NULL)
+			{
+				void* frontItem = NULL;
+
+				ListGetItem(list, 0, &frontItem);
+				memcpy(item, frontItem, list->dataSize);
+				item += list->dataSize;
+			}
+
+			ListPopFront(list);
+			popped++;
+		}
+	}
+
+	if (poppedCount != NULL)
+	{
+		*poppedCount = popped;
+	}
+
+	return 0;
+}
+
+int ListGetRange(LinkedList* list, size_t start, size_t count, void* items)
+{
+	TRACE_OPERATION(ListGetRange, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (start >= ListCount(list) || count > ListCount(list) - start)
+	{
+		return ERROR_INVALID_INDEX;
+	}
+	if (items == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	char* item = items;
+
+	if (list->storage != NULL)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			void* storedItem = list->storage->getItem(list->storageData, start + i);
+
+			if (storedItem == NULL)
+			{
+				return ERROR_ELEMENT_NULL;
+			}
+
+			memcpy(item, storedItem, list->dataSize);
+
+			item += list->dataSize;
+		}
+
+		return 0;
+	}
+
+	LinkedListElement* element = GetElement(list, start);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		if (element == NULL)
+		{
+			return ERROR_INVALID_INDEX;
+		}
+
+		memcpy(item, GetData(element), list->dataSize);
+
+		item += list->dataSize;
+		element = GetLink(&element->next);
+		TRACE_STEPS(1);
+	}
+
+	return 0;
+}
+
+static int PopStoredRange(LinkedList* list, size_t start, size_t count)
+{
+	size_t listCount = ListCount(list);
+
+	for (size_t i = start; start > 0 && i + count < listCount; i++)
+	{
+		int result = list->storage->replace(list->storageData, i, list->storage->getItem(list->storageData, i + count));
+
+		if (result != 0)
+		{
+			return result;
+		}
+	}
+
+	if (start > 0)
+	{
+		return TruncateStoredItems(list, listCount - count);
+	}
+
+	for (size_t i = 0; i < count; i++)
+	{
+		int result = list->storage->popFront(list->storageData);
+
+		if (result != 0)
+		{
+			return result;
+		}
+	}
+
+	return 0;
+}
+
+int ListPopRange(LinkedList* list, size_t start, size_t count)
+{
+	TRACE_OPERATION(ListPopRange, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (start >= ListCount(list) || count > ListCount(list) - start)
+	{
+		return ERROR_INVALID_INDEX;
+	}
+
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	if (list->storage != NULL)
+	{
+		return PopStoredRange(list, start, count);
+	}
+
+	LinkedListElement** link = &list->element;
+
+	if (start > 0)
+	{
+		LinkedListElement* leftFromRemoveElement = GetExclusiveElement(list, start - 1);
+
+		if (leftFromRemoveElement == NULL)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		link = &leftFromRemoveElement->next;
+	}
+
+	LinkedListElement* firstRemoveElement = GetLink(link);
+	LinkedListElement* lastRemoveElement = firstRemoveElement;
+
+	for (size_t i = 1; i < count; i++)
+	{
+		lastRemoveElement = GetLink(&lastRemoveElement->next);
+	}
+
+	LinkedListElement* rightFromRemoveElement = GetLink(&lastRemoveElement->next);
+
+	// The run is cut out with one link update. That link is a new reference to the element after the run,
+	// and releasing the run gives back the one the run held, so clones sharing any part of it stay intact.
+	if (rightFromRemoveElement != NULL)
+	{
+		RetainElement(rightFromRemoveElement);
+	}
+	else
+	{
+		list->tail = NULL;
+	}
+
+	SetLink(link, rightFromRemoveElement);
+	ReleaseElements(list, firstRemoveElement);
+	RemoveLanes(list, start, count);
+	DecreaseCountBy(list, count);
+
+	return 0;
+}
+
+int ListReplaceRange(LinkedList* list, size_t start, size_t count, const void* items)
+{
+	TRACE_OPERATION(ListReplaceRange, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (IsSorted(list))
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (start >= ListCount(list) || count > ListCount(list) - start)
+	{
+		return ERROR_INVALID_INDEX;
+	}
+	if (items == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	const char* item = items;
+
+	if (list->storage != NULL)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			int result = list->storage->replace(list->storageData, start + i, item);
+
+			if (result != 0)
+			{
+				return result;
+			}
+
+			item += list->dataSize;
+		}
+
+		return 0;
+	}
+
+	LinkedListElement* element = GetExclusiveRange(list, start, start + count - 1);
+
+	if (element == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	for (size_t i = 0; i < count; i++)
+	{
+		int result = ReplaceData(list, element, item);
+
+		if (result != 0)
+		{
+			return result;
+		}
+
+		item += list->dataSize;
+		element = element->next;
+	}
+
+	return 0;
+}
+
+static int RotateStoredItems(LinkedList* list, size_t count)
+{
+	void* item = list->allocator.alloc(list->allocator.ctx, list->dataSize);
+
+	if (item == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	int result = 0;
+
+	for (size_t i = 0; i < count && result == 0; i++)
+	{
+		void* storedItem = list->storage->getItem(list->storageData, 0);
+
+		if (storedItem == NULL)
+		{
+			result = ERROR_ELEMENT_NULL;
+
+			break;
+		}
+
+		memcpy(item, storedItem, list->dataSize);
+
+		result = list->storage->popFront(list->storageData);
+		result = result == 0 ? list->storage->pushBack(list->storageData, item) : result;
+	}
+
+	list->allocator.free(list->allocator.ctx, item, list->dataSize);
+
+	return result;
+}
+
+/*
+ * Moves the first count elements behind the last one by closing the chain
+ * into a ring at the cached tail and cutting it open again after the new
+ * last element. Rotating by one costs three link updates, whatever the
+ * length of the list, and never touches an item.
+ */
+int ListRotate(LinkedList* list, size_t count)
+{
+	TRACE_OPERATION(ListRotate, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (IsSorted(list) || list->concurrent)
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+
+	count %= ListCount(list);
+
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	if (list->storage != NULL)
+	{
+		return RotateStoredItems(list, count);
+	}
+
+	if (list->shared && GetExclusiveRange(list, 0, ListCount(list) - 1) == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	LinkedListElement* lastElement = GetTail(list);
+	LinkedListElement* newLastElement = GetElement(list, count - 1);
+
+	lastElement->next = list->element;
+	list->element = newLastElement->next;
+	newLastElement->next = NULL;
+	list->tail = newLastElement;
+
+	return 0;
+}
+
+int ListRemoveIf(LinkedList* list, int (*predicate)(const void*, void*), void* ctx, size_t* removedCount)
+{
+	TRACE_OPERATION(ListRemoveIf, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (predicate == NULL)
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+
+	ssize_t removed = RemoveElements(list, predicate, ctx, 1);
+
+	if (removed < 0)
+	{
+		return removed;
+	}
+	if (removedCount != NULL)
+	{
+		*removedCount = removed;
+	}
+
+	return 0;
+}
+
+int ListRetainIf(LinkedList* list, int (*predicate)(const void*, void*), void* ctx, size_t* removedCount)
+{
+	TRACE_OPERATION(ListRetainIf, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (predicate == NULL)
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+
+	ssize_t removed = RemoveElements(list, predicate, ctx, 0);
+
+	if (removed < 0)
+	{
+		return removed;
+	}
+	if (removedCount != NULL)
+	{
+		*removedCount = removed;
+	}
+
+	return 0;
+}
+
+LinkedList* ListClone(LinkedList* list)
+{
+	TRACE_OPERATION(ListClone, list);
+
+	if (list == NULL || list->storage != NULL)
+	{
+		return NULL;
+	}
+
+	LinkedList* cloneList = ListInitialiseWithAllocator(list->dataSize, &list->allocator);
+
+	if (cloneList == NULL)
+	{
+		return NULL;
+	}
+
+	cloneList->element = list->element;
+	cloneList->tail = list->tail;
+	cloneList->count = list->count;
+	cloneList->compar = list->compar;
+	cloneList->concurrent = list->concurrent;
+	cloneList->organisation = list->organisation;
+	cloneList->shared = 1;
+	list->shared = 1;
+
+	if (cloneList->element != NULL)
+	{
+		RetainElement(cloneList->element);
+	}
+
+	return cloneList;
+}
+
+int ListInsertSorted(LinkedList* list, void* item)
+{
+	TRACE_OPERATION(ListInsertSorted, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (!IsSorted(list))
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	if (list->shared && ListCount(list) > 0 && GetExclusiveElement(list, ListCount(list) - 1) == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+	if (!AreLanesBalanced(list))
+	{
+		BuildLanes(list);
+	}
+
+	LinkedListElement* previousElement = NULL;
+	size_t index = 0;
+	LinkedListElement* nextElement = FindLowerBound(list, item, &previousElement, &index);
+	LinkedListElement* newElement = CreateElement(list, item);
+
+	if (newElement == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	newElement->next = nextElement;
+	SetLink(previousElement == NULL ? &list->element : &previousElement->next, newElement);
+
+	if (nextElement == NULL)
+	{
+		list->tail = newElement;
+	}
+
+	InsertLane(list, index);
+	IncreaseCount(list);
+
+	return 0;
+}
+
+int ListFindSorted(LinkedList* list, size_t* index, void* item)
+{
+	TRACE_OPERATION(ListFindSorted, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (!IsSorted(list))
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (index == NULL)
+	{
+		return ERROR_INDEX_NULL;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	if (!AreLanesBalanced(list))
+	{
+		BuildLanes(list);
+	}
+
+	LinkedListElement* previousElement = NULL;
+	size_t itemIndex = 0;
+	LinkedListElement* element = FindLowerBound(list, item, &previousElement, &itemIndex);
+
+	if (element == NULL || list->compar(element->data, item) != 0)
+	{
+		return ERROR_INVALID_ITEM;
+	}
+
+	*index = itemIndex;
+
+	return 0;
+}
+
+int ListLowerBound(LinkedList* list, size_t* index, void* item)
+{
+	TRACE_OPERATION(ListLowerBound, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (!IsSorted(list))
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+	if (index == NULL)
+	{
+		return ERROR_INDEX_NULL;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	if (!AreLanesBalanced(list))
+	{
+		BuildLanes(list);
+	}
+
+	LinkedListElement* previousElement = NULL;
+
+	FindLowerBound(list, item, &previousElement, index);
+
+	return 0;
+}
+
+static uint64_t GetSortKey(const void* data, size_t keyOffset, size_t keyWidth)
+{
+	const unsigned char* key = (const unsigned char*)data + keyOffset;
+	uint8_t key8;
+	uint16_t key16;
+	uint32_t key32;
+	uint64_t key64;
+
+	switch (keyWidth)
+	{
+	case 1:
+		memcpy(&key8, key, sizeof(key8));
+		return key8;
+	case 2:
+		memcpy(&key16, key, sizeof(key16));
+		return key16;
+	case 4:
+		memcpy(&key32, key, sizeof(key32));
+		return key32;
+	default:
+		memcpy(&key64, key, sizeof(key64));
+		return key64;
+	}
+}
+
+typedef struct LinkedListSortEntry
+{
+	uint64_t key;
+	LinkedListElement* element;
+} LinkedListSortEntry;
+
+/*
+ * LSD radix sort over the key bytes. The keys are read once into an array
+ * next to their elements, the array is sorted with one stable counting pass
+ * per key byte and the elements are relinked in the resulting order, so no
+ * item is copied and only the first and last pass chase pointers. A pass is
+ * skipped when all keys share that byte.
+ */
+int ListSortByKey(LinkedList* list, size_t keyOffset, size_t keyWidth)
+{
+	TRACE_OPERATION(ListSortByKey, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (IsSorted(list) || list->storage != NULL || list->concurrent)
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (keyWidth != 1 && keyWidth != 2 && keyWidth != 4 && keyWidth != 8)
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (keyOffset > list->dataSize || keyWidth > list->dataSize - keyOffset)
+	{
+		return ERROR_INVALID_INDEX;
+	}
+	if (ListCount(list) == 0)
+	{
+		return ERROR_LIST_EMPTY;
+	}
+
+	if (list->shared && GetExclusiveRange(list, 0, ListCount(list) - 1) == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
 
-		return 0;
+	size_t count = ListCount(list);
+	LinkedListSortEntry* entries = list->allocator.alloc(list->allocator.ctx, 2 * count * sizeof(LinkedListSortEntry));
+
+	if (entries == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
 	}
-	if (index == ListCount(list) - 1)
+
+	LinkedListSortEntry* sortedEntries = entries + count;
+	size_t histograms[8][256] = { { 0 } };
+	LinkedListElement* element = list->element;
+
+	for (size_t i = 0; i < count; i++)
 	{
-		ListPopBack(list);
+		uint64_t key = GetSortKey(element->data, keyOffset, keyWidth);
 
-		return 0;
+		for (size_t digit = 0; digit < keyWidth; digit++)
+		{
+			histograms[digit][(key >> (digit * 8)) & 0xFF]++;
+		}
+
+		entries[i] = (LinkedListSortEntry) { key, element };
+		element = element->next;
 	}
 
-	LinkedListElement* leftFromRemoveElement = GetElement(list, index - 1);
-	LinkedListElement* rightFromRemoveElement = leftFromRemoveElement->next->next;
+	for (size_t digit = 0; digit < keyWidth; digit++)
+	{
+		size_t* histogram = histograms[digit];
 
-	FreeElement(&leftFromRemoveElement->next);
-	DecreaseCount(list);
+		if (histogram[(entries[0].key >> (digit * 8)) & 0xFF] == count)
+		{
+			continue;
+		}
+
+		size_t offset = 0;
+
+		for (size_t bucket = 0; bucket < 256; bucket++)
+		{
+			size_t bucketCount = histogram[bucket];
+
+			histogram[bucket] = offset;
+			offset += bucketCount;
+		}
+
+		for (size_t i = 0; i < count; i++)
+		{
+			sortedEntries[histogram[(entries[i].key >> (digit * 8)) & 0xFF]++] = entries[i];
+		}
 
-	leftFromRemoveElement->next = rightFromRemoveElement;
+		LinkedListSortEntry* swappedEntries = entries;
+		entries = sortedEntries;
+		sortedEntries = swappedEntries;
+	}
+
+	list->element = entries[0].element;
+
+	for (size_t i = 0; i + 1 < count; i++)
+	{
+		entries[i].element->next = entries[i + 1].element;
+	}
+
+	entries[count - 1].element->next = NULL;
+	list->tail = entries[count - 1].element;
+
+	list->allocator.free(list->allocator.ctx, entries < sortedEntries ? entries : sortedEntries,
+		2 * count * sizeof(LinkedListSortEntry));
 
 	return 0;
 }
 
-int ListReplace(LinkedList* list, size_t index, void* item)
+static int HaveSameAllocator(LinkedList* listOne, LinkedList* listTwo)
 {
-	if (list == NULL)
+	return listOne->allocator.alloc == listTwo->allocator.alloc && listOne->allocator.free == listTwo->allocator.free &&
+		listOne->allocator.ctx == listTwo->allocator.ctx;
+}
+
+int ListMergeSorted(LinkedList* destination, LinkedList* source, int (*compar)(const void*, const void*))
+{
+	TRACE_OPERATION(ListMergeSorted, destination);
+
+	if (destination == NULL || source == NULL)
 	{
 		return ERROR_LIST_NULL;
 	}
-	if (ListCount(list) == 0)
+	if (compar == NULL)
 	{
-		return ERROR_LIST_EMPTY;
+		compar = destination->compar;
 	}
-	if (index >= ListCount(list))
+	if (compar == NULL || (IsSorted(destination) && compar != destination->compar) ||
+		(IsSorted(source) && compar != source->compar))
 	{
-		return ERROR_INVALID_INDEX;
+		return ERROR_INVALID_OPERATION;
 	}
-	if (item == NULL)
+	if (destination == source || destination->dataSize != source->dataSize || !HaveSameAllocator(destination, source))
 	{
-		return ERROR_ITEM_NULL;
+		return ERROR_INVALID_OPERATION;
+	}
+	if (destination->storage != NULL || source->storage != NULL || destination->concurrent || source->concurrent)
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+
+	if (destination->shared && ListCount(destination) > 0 &&
+		GetExclusiveRange(destination, 0, ListCount(destination) - 1) == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+	if (source->shared && ListCount(source) > 0 && GetExclusiveRange(source, 0, ListCount(source) - 1) == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	LinkedListElement* destinationElement = destination->element;
+	LinkedListElement* sourceElement = source->element;
+	LinkedListElement** link = &destination->element;
+
+	while (destinationElement != NULL && sourceElement != NULL)
+	{
+		if (compar(sourceElement->data, destinationElement->data) < 0)
+		{
+			*link = sourceElement;
+			sourceElement = sourceElement->next;
+		}
+		else
+		{
+			*link = destinationElement;
+			destinationElement = destinationElement->next;
+		}
+
+		link = &(*link)->next;
 	}
 
-	LinkedListElement* replaceElement = GetElement(list, index);
+	*link = destinationElement != NULL ? destinationElement : sourceElement;
+	source->element = NULL;
+	destination->tail = NULL;
+	source->tail = NULL;
 
-	memcpy(replaceElement->data, item, list->dataSize);
+	SetCount(destination, ListCount(destination) + ListCount(source));
+	ClearCount(source);
+	InvalidateLanes(destination);
+	InvalidateLanes(source);
 
 	return 0;
 }
 
-int ListClear(LinkedList* list)
+int ListConcatenate(LinkedList* destination, LinkedList* source)
 {
-	if (list == NULL)
+	TRACE_OPERATION(ListConcatenate, destination);
+
+	if (destination == NULL || source == NULL)
 	{
 		return ERROR_LIST_NULL;
 	}
-	if (ListCount(list) == 0)
+	if (destination == source || destination->dataSize != source->dataSize || !HaveSameAllocator(destination, source))
 	{
-		return ERROR_LIST_EMPTY;
+		return ERROR_INVALID_OPERATION;
+	}
+	if (destination->storage != NULL || source->storage != NULL || destination->concurrent || source->concurrent)
+	{
+		return ERROR_INVALID_OPERATION;
+	}
+	if (IsSorted(destination))
+	{
+		return ERROR_INVALID_OPERATION;
 	}
 
-	while (ListCount(list) > 0)
+	if (ListCount(source) == 0)
 	{
-		ListPopFront(list);
+		return 0;
+	}
+
+	if (source->shared && GetExclusiveRange(source, 0, ListCount(source) - 1) == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	if (ListCount(destination) == 0)
+	{
+		destination->element = source->element;
+	}
+	else
+	{
+		LinkedListElement* lastElement = destination->shared ? GetExclusiveElement(destination, ListCount(destination) - 1) :
+			GetTail(destination);
+
+		if (lastElement == NULL)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		SetLink(&lastElement->next, source->element);
+	}
+
+	destination->tail = source->tail;
+	source->element = NULL;
+	source->tail = NULL;
+
+	SetCount(destination, ListCount(destination) + ListCount(source));
+	ClearCount(source);
+	InvalidateLanes(source);
+
+	return 0;
+}
+
+typedef struct LinkedListCursor
+{
+	LinkedList* list;
+	LinkedListElement* element;
+	size_t index;
+} LinkedListCursor;
+
+static void* GetCursorItem(LinkedListCursor* cursor)
+{
+	if (cursor->index >= ListCount(cursor->list))
+	{
+		return NULL;
+	}
+	if (cursor->list->storage != NULL)
+	{
+		return cursor->list->storage->getItem(cursor->list->storageData, cursor->index);
+	}
+
+	return cursor->element != NULL ? GetData(cursor->element) : NULL;
+}
+
+static void AdvanceCursor(LinkedListCursor* cursor)
+{
+	if (cursor->list->storage == NULL && cursor->element != NULL)
+	{
+		cursor->element = GetLink(&cursor->element->next);
+	}
+
+	cursor->index++;
+}
+
+static int AppendItem(LinkedList* list, LinkedListElement*** link, void* item)
+{
+	LinkedListElement* element = CreateElement(list, item);
+
+	if (element == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
 	}
 
+	**link = element;
+	*link = &element->next;
+	IncreaseCount(list);
+
 	return 0;
 }
 
-int ListGetItem(LinkedList* list, size_t index, void** item)
+/*
+ * Walks both lists once like a merge. The flags select which items end up
+ * in the new list: those only in the first list, those in both, and those
+ * only in the second list. Equal items pair up one to one, so duplicates
+ * follow multiset rules.
+ */
+static LinkedList* CombineSorted(LinkedList* listOne, LinkedList* listTwo, int (*compar)(const void*, const void*),
+	int keepOne, int keepBoth, int keepTwo)
+{
+	if (listOne == NULL || listTwo == NULL || listOne->dataSize != listTwo->dataSize)
+	{
+		return NULL;
+	}
+	if (compar == NULL)
+	{
+		compar = listOne->compar;
+	}
+	if (compar == NULL || (IsSorted(listOne) && compar != listOne->compar) ||
+		(IsSorted(listTwo) && compar != listTwo->compar))
+	{
+		return NULL;
+	}
+
+	LinkedList* list = ListInitialiseWithAllocator(listOne->dataSize, &listOne->allocator);
+
+	if (list == NULL)
+	{
+		return NULL;
+	}
+
+	// Combining two sorted lists gives a sorted list, whose lanes are built by its first search.
+	if (IsSorted(listOne) && IsSorted(listTwo))
+	{
+		list->compar = compar;
+	}
+
+	LinkedListCursor cursorOne = { listOne, GetLink(&listOne->element), 0 };
+	LinkedListCursor cursorTwo = { listTwo, GetLink(&listTwo->element), 0 };
+	LinkedListElement** link = &list->element;
+	void* itemOne = GetCursorItem(&cursorOne);
+	void* itemTwo = GetCursorItem(&cursorTwo);
+	int result = 0;
+
+	while (result == 0 && (itemOne != NULL || itemTwo != NULL))
+	{
+		int order = itemOne == NULL ? 1 : itemTwo == NULL ? -1 : compar(itemOne, itemTwo);
+
+		if (order < 0)
+		{
+			result = keepOne ? AppendItem(list, &link, itemOne) : 0;
+			AdvanceCursor(&cursorOne);
+		}
+		else if (order > 0)
+		{
+			result = keepTwo ? AppendItem(list, &link, itemTwo) : 0;
+			AdvanceCursor(&cursorTwo);
+		}
+		else
+		{
+			result = keepBoth ? AppendItem(list, &link, itemOne) : 0;
+			AdvanceCursor(&cursorOne);
+			AdvanceCursor(&cursorTwo);
+		}
+
+		itemOne = GetCursorItem(&cursorOne);
+		itemTwo = GetCursorItem(&cursorTwo);
+	}
+
+	if (result != 0)
+	{
+		ListDestroy(&list);
+	}
+
+	return list;
+}
+
+LinkedList* ListIntersectSorted(LinkedList* listOne, LinkedList* listTwo, int (*compar)(const void*, const void*))
+{
+	TRACE_OPERATION(ListIntersectSorted, listOne);
+
+	return CombineSorted(listOne, listTwo, compar, 0, 1, 0);
+}
+
+LinkedList* ListDifferenceSorted(LinkedList* listOne, LinkedList* listTwo, int (*compar)(const void*, const void*))
+{
+	TRACE_OPERATION(ListDifferenceSorted, listOne);
+
+	return CombineSorted(listOne, listTwo, compar, 1, 0, 0);
+}
+
+LinkedList* ListUnionSorted(LinkedList* listOne, LinkedList* listTwo, int (*compar)(const void*, const void*))
+{
+	TRACE_OPERATION(ListUnionSorted, listOne);
+
+	return CombineSorted(listOne, listTwo, compar, 1, 1, 1);
+}
+
+static size_t AlignSize(size_t size)
+{
+	size_t alignment = sizeof(max_align_t);
+
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+static LinkedListRegion* CreateRegion(LinkedList* list, size_t elementCount, size_t elementSize)
+{
+	size_t size = AlignSize(sizeof(LinkedListRegion)) + elementCount * elementSize;
+	LinkedListRegion* region = list->allocator.alloc(list->allocator.ctx, size);
+
+	if (region == NULL)
+	{
+		return NULL;
+	}
+
+	region->liveCount = elementCount;
+	region->size = size;
+
+	return region;
+}
+
+/*
+ * Elements are copied into regions of at most REGION_MAXIMUM_SIZE bytes one
+ * after the other, so a walk reads memory sequentially. Shared elements are
+ * copied the same way GetExclusiveRange copies them and stay with the clones.
+ * When a region cannot be allocated the list is left partly compacted.
+ */
+int ListCompact(LinkedList* list)
 {
+	TRACE_OPERATION(ListCompact, list);
+
 	if (list == NULL)
 	{
 		return ERROR_LIST_NULL;
 	}
-	if (ListCount(list) == 0)
+
+	if (list->storage != NULL || list->concurrent)
 	{
-		return ERROR_LIST_EMPTY;
+		return ERROR_INVALID_OPERATION;
 	}
-	if (index >= ListCount(list))
+
+	size_t elementSize = AlignSize(sizeof(LinkedListElement)) + AlignSize(list->dataSize);
+	size_t regionCapacity = (REGION_MAXIMUM_SIZE - AlignSize(sizeof(LinkedListRegion))) / elementSize;
+	size_t remaining = ListCount(list);
+	LinkedListElement** link = &list->element;
+	LinkedListElement* lastElement = NULL;
+
+	if (regionCapacity == 0)
 	{
-		return ERROR_INVALID_INDEX;
+		regionCapacity = 1;
 	}
-	if (item == NULL)
+
+	InvalidateLanes(list);
+
+	while (remaining > 0)
 	{
-		return ERROR_ITEM_NULL;
+		size_t elementCount = remaining < regionCapacity ? remaining : regionCapacity;
+		LinkedListRegion* region = CreateRegion(list, elementCount, elementSize);
+
+		if (region == NULL)
+		{
+			list->tail = NULL;
+
+			return ERROR_ELEMENT_NULL;
+		}
+
+		unsigned char* memory = (unsigned char*)region + AlignSize(sizeof(LinkedListRegion));
+
+		for (size_t i = 0; i < elementCount; i++)
+		{
+			LinkedListElement* element = *link;
+			LinkedListElement* copyElement = (LinkedListElement*)(memory + i * elementSize);
+
+			copyElement->data = (unsigned char*)copyElement + AlignSize(sizeof(LinkedListElement));
+			copyElement->next = element->next;
+			copyElement->references = 1;
+			copyElement->region = region;
+			copyElement->hits = element->hits;
+			memcpy(copyElement->data, element->data, list->dataSize);
+
+			if (IsElementShared(element))
+			{
+				if (copyElement->next != NULL)
+				{
+					RetainElement(copyElement->next);
+				}
+
+				ReleaseElements(list, element);
+			}
+			else
+			{
+				FreeElement(list, &element);
+			}
+
+			*link = copyElement;
+			link = &copyElement->next;
+			lastElement = copyElement;
+		}
+
+		remaining -= elementCount;
 	}
 
-	LinkedListElement* element = GetElement(list, index);
+	TRACE_STEPS(ListCount(list));
 
-	*item = element->data;
+	list->tail = lastElement;
+	list->shared = 0;
 
 	return 0;
 }
 
-int ListGetIndex(LinkedList* list, size_t* index, void* item, int (*compar)(const void*, const void*))
+/*
+ * A hop counts as sequential when the next element lies at most
+ * SEQUENTIAL_DISTANCE bytes past the current one, so a freshly compacted list
+ * reports 0 and a list whose every hop jumps elsewhere reports 1.
+ */
+int ListFragmentation(LinkedList* list, double* fragmentation)
 {
+	TRACE_OPERATION(ListFragmentation, list);
+
 	if (list == NULL)
 	{
 		return ERROR_LIST_NULL;
 	}
-	if (ListCount(list) == 0)
+
+	if (fragmentation == NULL)
 	{
-		return ERROR_LIST_EMPTY;
+		return ERROR_ITEM_NULL;
 	}
-	if (index == NULL)
+
+	if (list->storage != NULL)
 	{
-		return ERROR_INDEX_NULL;
+		return ERROR_INVALID_OPERATION;
 	}
-	if (item == NULL)
+
+	size_t hops = 0;
+	size_t jumps = 0;
+	LinkedListElement* element = GetLink(&list->element);
+
+	while (element != NULL)
 	{
-		return ERROR_ITEM_NULL;
+		LinkedListElement* nextElement = GetLink(&element->next);
+
+		if (nextElement == NULL)
+		{
+			break;
+		}
+
+		uintptr_t distance = (uintptr_t)nextElement - (uintptr_t)element;
+
+		if ((uintptr_t)nextElement < (uintptr_t)element || distance > SEQUENTIAL_DISTANCE)
+		{
+			jumps++;
+		}
+
+		hops++;
+		element = nextElement;
 	}
 
-	ssize_t itemIndex = GetIndex(list, item, compar);
+	TRACE_STEPS(hops);
 
-	if (itemIndex == ERROR_INVALID_ITEM)
+	*fragmentation = hops > 0 ? (double)jumps / (double)hops : 0.0;
+
+	return 0;
+}
+
+int ListReadBegin(LinkedList* list)
+{
+	TRACE_OPERATION(ListReadBegin, list);
+
+	if (list == NULL)
 	{
-		return ERROR_INVALID_ITEM;
+		return ERROR_LIST_NULL;
 	}
 
-	*index = itemIndex;
+	if (EpochReadBegin() != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	return 0;
+}
+
+int ListReadEnd(LinkedList* list)
+{
+	TRACE_OPERATION(ListReadEnd, list);
+
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	EpochReadEnd();
 
 	return 0;
 }
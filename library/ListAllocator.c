@@ -0,0 +1,114 @@
+#include "LinkedList/LinkedList.h"
+#include <pthread.h>
+#include <stdlib.h>
+
+#define CACHE_SIZE_STEP 16
+#define CACHE_CLASS_COUNT 16
+#define CACHE_BIN_CAPACITY 1024
+
+typedef struct CachedBlock
+{
+	struct CachedBlock* next;
+} CachedBlock;
+
+typedef struct ThreadCache
+{
+	CachedBlock* bins[CACHE_CLASS_COUNT];
+	size_t counts[CACHE_CLASS_COUNT];
+	int registered;
+} ThreadCache;
+
+static pthread_once_t cacheKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t cacheKey;
+
+static _Thread_local ThreadCache threadCache;
+
+static void FlushThreadCache(void* cache)
+{
+	ThreadCache* threadCache = cache;
+
+	for (size_t i = 0; i < CACHE_CLASS_COUNT; i++)
+	{
+		while (threadCache->bins[i] != NULL)
+		{
+			CachedBlock* block = threadCache->bins[i];
+
+			threadCache->bins[i] = block->next;
+			free(block);
+		}
+
+		threadCache->counts[i] = 0;
+	}
+}
+
+static void CreateCacheKey(void)
+{
+	pthread_key_create(&cacheKey, FlushThreadCache);
+}
+
+static void RegisterThreadCache(void)
+{
+	pthread_once(&cacheKeyOnce, CreateCacheKey);
+	pthread_setspecific(cacheKey, &threadCache);
+
+	threadCache.registered = 1;
+}
+
+static size_t GetSizeClass(size_t size)
+{
+	return (size + CACHE_SIZE_STEP - 1) / CACHE_SIZE_STEP - 1;
+}
+
+static void* AllocateCached(void* ctx, size_t size)
+{
+	(void)ctx;
+
+	size_t sizeClass = GetSizeClass(size);
+
+	if (size == 0 || sizeClass >= CACHE_CLASS_COUNT)
+	{
+		return malloc(size);
+	}
+
+	CachedBlock* block = threadCache.bins[sizeClass];
+
+	if (block == NULL)
+	{
+		return malloc((sizeClass + 1) * CACHE_SIZE_STEP);
+	}
+
+	threadCache.bins[sizeClass] = block->next;
+	threadCache.counts[sizeClass]--;
+
+	return block;
+}
+
+static void FreeCached(void* ctx, void* pointer, size_t size)
+{
+	(void)ctx;
+
+	size_t sizeClass = GetSizeClass(size);
+
+	if (pointer == NULL)
+	{
+		return;
+	}
+	if (size == 0 || sizeClass >= CACHE_CLASS_COUNT || threadCache.counts[sizeClass] == CACHE_BIN_CAPACITY)
+	{
+		free(pointer);
+
+		return;
+	}
+	if (!threadCache.registered)
+	{
+		RegisterThreadCache();
+	}
+
+	CachedBlock* block = pointer;
+
+	block->next = threadCache.bins[sizeClass];
+	threadCache.bins[sizeClass] = block;
+	threadCache.counts[sizeClass]++;
+}
+
+const ListAllocator ListThreadCacheAllocator = { AllocateCached, FreeCached, NULL };
@@ -0,0 +1,636 @@
+#include "ListStorage.h"
+#include <stdint.h>
+#include <string.h>
+
+#define COMPRESSED_BLOCK_ITEMS 128
+#define COMPRESSED_DECODED_BLOCKS 2
+#define COMPRESSED_NO_BLOCK SIZE_MAX
+
+/*
+ * A block stores its first value and, for every following value, the
+ * difference to the one before minus the smallest such difference, packed
+ * with just enough bits for the largest. Runs of increasing IDs cost a few
+ * bits per item, and decoding is the same shift and mask for every item.
+ */
+typedef struct ListCompressedBlock
+{
+	uint64_t* words;
+	size_t wordCount;
+	uint64_t first;
+	uint64_t minimumDelta;
+	size_t count;
+	unsigned width;
+} ListCompressedBlock;
+
+typedef struct ListDecodedBlock
+{
+	unsigned char* items;
+	size_t block;
+	int dirty;
+} ListDecodedBlock;
+
+/*
+ * The two blocks used last are kept decoded. Items are read from and changed
+ * in the decoded copies, which are packed again only when their slot is
+ * needed for another block, so pushing at the back packs each block once.
+ * With two slots an item pointer handed out by one call stays valid through
+ * the next, which copying an item from one index to another relies on.
+ */
+typedef struct ListCompressed
+{
+	ListCompressedBlock* blocks;
+	size_t blockCount;
+	size_t blockCapacity;
+	size_t count;
+	ListDecodedBlock decoded[COMPRESSED_DECODED_BLOCKS];
+	size_t newestDecoded;
+	size_t cursorBlock;
+	size_t cursorIndex;
+	size_t dataSize;
+	ListAllocator allocator;
+} ListCompressed;
+
+/*
+ * Four-byte items are sign-extended, so small negative values and deltas
+ * pack as tightly as small positive ones.
+ */
+static uint64_t GetDecodedValue(ListCompressed* compressed, const unsigned char* items, size_t offset)
+{
+	if (compressed->dataSize == sizeof(uint32_t))
+	{
+		int32_t value;
+
+		memcpy(&value, items + offset * sizeof(int32_t), sizeof(int32_t));
+
+		return (uint64_t)(int64_t)value;
+	}
+
+	uint64_t value;
+
+	memcpy(&value, items + offset * sizeof(uint64_t), sizeof(uint64_t));
+
+	return value;
+}
+
+static void SetDecodedValue(ListCompressed* compressed, unsigned char* items, size_t offset, uint64_t value)
+{
+	if (compressed->dataSize == sizeof(uint32_t))
+	{
+		uint32_t truncatedValue = (uint32_t)value;
+
+		memcpy(items + offset * sizeof(uint32_t), &truncatedValue, sizeof(uint32_t));
+
+		return;
+	}
+
+	memcpy(items + offset * sizeof(uint64_t), &value, sizeof(uint64_t));
+}
+
+static unsigned char* GetDecodedSlot(ListCompressed* compressed, ListDecodedBlock* decoded, size_t offset)
+{
+	return decoded->items + offset * compressed->dataSize;
+}
+
+void* ListCompressedCreate(size_t dataSize, const ListAllocator* allocator)
+{
+	ListCompressed* compressed = allocator->alloc(allocator->ctx, sizeof(ListCompressed));
+
+	if (compressed == NULL)
+	{
+		return NULL;
+	}
+
+	unsigned char* items = allocator->alloc(allocator->ctx, COMPRESSED_DECODED_BLOCKS * COMPRESSED_BLOCK_ITEMS * dataSize);
+
+	if (items == NULL)
+	{
+		allocator->free(allocator->ctx, compressed, sizeof(ListCompressed));
+
+		return NULL;
+	}
+
+	for (size_t i = 0; i < COMPRESSED_DECODED_BLOCKS; i++)
+	{
+		compressed->decoded[i].items = items + i * COMPRESSED_BLOCK_ITEMS * dataSize;
+		compressed->decoded[i].block = COMPRESSED_NO_BLOCK;
+		compressed->decoded[i].dirty = 0;
+	}
+
+	compressed->newestDecoded = 0;
+	compressed->blocks = NULL;
+	compressed->blockCount = 0;
+	compressed->blockCapacity = 0;
+	compressed->count = 0;
+	compressed->cursorBlock = 0;
+	compressed->cursorIndex = 0;
+	compressed->dataSize = dataSize;
+	compressed->allocator = *allocator;
+
+	return compressed;
+}
+
+static void FreeWords(ListCompressed* compressed, ListCompressedBlock* block)
+{
+	if (block->words != NULL)
+	{
+		compressed->allocator.free(compressed->allocator.ctx, block->words, block->wordCount * sizeof(uint64_t));
+	}
+
+	block->words = NULL;
+	block->wordCount = 0;
+}
+
+static unsigned GetBitWidth(uint64_t value)
+{
+	unsigned width = 0;
+
+	while (width < 64 && (value >> width) != 0)
+	{
+		width++;
+	}
+
+	return width;
+}
+
+static int EncodeBlock(ListCompressed* compressed, ListCompressedBlock* block, const unsigned char* items, size_t count)
+{
+	int64_t minimumDelta = INT64_MAX;
+	uint64_t deltaBits = 0;
+
+	for (size_t i = 1; i < count; i++)
+	{
+		int64_t delta = (int64_t)(GetDecodedValue(compressed, items, i) - GetDecodedValue(compressed, items, i - 1));
+
+		if (delta < minimumDelta)
+		{
+			minimumDelta = delta;
+		}
+	}
+
+	for (size_t i = 1; i < count; i++)
+	{
+		deltaBits |= GetDecodedValue(compressed, items, i) - GetDecodedValue(compressed, items, i - 1) - (uint64_t)minimumDelta;
+	}
+
+	unsigned width = GetBitWidth(deltaBits);
+	size_t wordCount = ((count > 0 ? count - 1 : 0) * width + 63) / 64;
+	uint64_t* words = NULL;
+
+	if (wordCount > 0)
+	{
+		words = compressed->allocator.alloc(compressed->allocator.ctx, wordCount * sizeof(uint64_t));
+
+		if (words == NULL)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		memset(words, 0, wordCount * sizeof(uint64_t));
+	}
+
+	for (size_t i = 1; i < count && width > 0; i++)
+	{
+		uint64_t packed = GetDecodedValue(compressed, items, i) - GetDecodedValue(compressed, items, i - 1) - (uint64_t)minimumDelta;
+		size_t bit = (i - 1) * width;
+
+		words[bit / 64] |= packed << (bit % 64);
+
+		if (bit % 64 + width > 64)
+		{
+			words[bit / 64 + 1] |= packed >> (64 - bit % 64);
+		}
+	}
+
+	FreeWords(compressed, block);
+
+	block->words = words;
+	block->wordCount = wordCount;
+	block->first = count > 0 ? GetDecodedValue(compressed, items, 0) : 0;
+	block->minimumDelta = count > 1 ? (uint64_t)minimumDelta : 0;
+	block->count = count;
+	block->width = width;
+
+	return 0;
+}
+
+static void DecodeBlock(ListCompressed* compressed, ListCompressedBlock* block, unsigned char* items)
+{
+	uint64_t mask = block->width == 64 ? UINT64_MAX : ((uint64_t)1 << block->width) - 1;
+	uint64_t value = block->first;
+
+	if (block->count > 0)
+	{
+		SetDecodedValue(compressed, items, 0, value);
+	}
+
+	for (size_t i = 1; i < block->count; i++)
+	{
+		uint64_t packed = 0;
+
+		if (block->width > 0)
+		{
+			size_t bit = (i - 1) * block->width;
+
+			packed = block->words[bit / 64] >> (bit % 64);
+
+			if (bit % 64 + block->width > 64)
+			{
+				packed |= block->words[bit / 64 + 1] << (64 - bit % 64);
+			}
+		}
+
+		value += block->minimumDelta + (packed & mask);
+		SetDecodedValue(compressed, items, i, value);
+	}
+}
+
+static int FlushBlock(ListCompressed* compressed, ListDecodedBlock* decoded)
+{
+	if (decoded->block == COMPRESSED_NO_BLOCK || !decoded->dirty)
+	{
+		return 0;
+	}
+
+	ListCompressedBlock* block = &compressed->blocks[decoded->block];
+
+	if (EncodeBlock(compressed, block, decoded->items, block->count) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	decoded->dirty = 0;
+
+	return 0;
+}
+
+/*
+ * Returns the decoded copy of the block at position, decoding it into the
+ * slot used least recently, or NULL when that slot could not be packed.
+ */
+static ListDecodedBlock* LoadBlock(ListCompressed* compressed, size_t position)
+{
+	for (size_t i = 0; i < COMPRESSED_DECODED_BLOCKS; i++)
+	{
+		if (compressed->decoded[i].block == position)
+		{
+			compressed->newestDecoded = i;
+
+			return &compressed->decoded[i];
+		}
+	}
+
+	size_t slot = (compressed->newestDecoded + 1) % COMPRESSED_DECODED_BLOCKS;
+	ListDecodedBlock* decoded = &compressed->decoded[slot];
+
+	if (FlushBlock(compressed, decoded) != 0)
+	{
+		return NULL;
+	}
+
+	DecodeBlock(compressed, &compressed->blocks[position], decoded->items);
+	decoded->block = position;
+	compressed->newestDecoded = slot;
+
+	return decoded;
+}
+
+static int InsertBlock(ListCompressed* compressed, size_t position)
+{
+	if (compressed->blockCount == compressed->blockCapacity)
+	{
+		size_t blockCapacity = compressed->blockCapacity == 0 ? 8 : compressed->blockCapacity * 2;
+		ListCompressedBlock* blocks = compressed->allocator.alloc(compressed->allocator.ctx,
+			blockCapacity * sizeof(ListCompressedBlock));
+
+		if (blocks == NULL)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		if (compressed->blocks != NULL)
+		{
+			memcpy(blocks, compressed->blocks, compressed->blockCount * sizeof(ListCompressedBlock));
+			compressed->allocator.free(compressed->allocator.ctx, compressed->blocks,
+				compressed->blockCapacity * sizeof(ListCompressedBlock));
+		}
+
+		compressed->blocks = blocks;
+		compressed->blockCapacity = blockCapacity;
+	}
+
+	memmove(&compressed->blocks[position + 1], &compressed->blocks[position],
+		(compressed->blockCount - position) * sizeof(ListCompressedBlock));
+	memset(&compressed->blocks[position], 0, sizeof(ListCompressedBlock));
+	compressed->blockCount++;
+	compressed->cursorBlock = 0;
+	compressed->cursorIndex = 0;
+
+	for (size_t i = 0; i < COMPRESSED_DECODED_BLOCKS; i++)
+	{
+		if (compressed->decoded[i].block != COMPRESSED_NO_BLOCK && compressed->decoded[i].block >= position)
+		{
+			compressed->decoded[i].block++;
+		}
+	}
+
+	return 0;
+}
+
+static void RemoveBlock(ListCompressed* compressed, size_t position)
+{
+	FreeWords(compressed, &compressed->blocks[position]);
+
+	memmove(&compressed->blocks[position], &compressed->blocks[position + 1],
+		(compressed->blockCount - position - 1) * sizeof(ListCompressedBlock));
+	compressed->blockCount--;
+	compressed->cursorBlock = 0;
+	compressed->cursorIndex = 0;
+
+	for (size_t i = 0; i < COMPRESSED_DECODED_BLOCKS; i++)
+	{
+		if (compressed->decoded[i].block == position)
+		{
+			compressed->decoded[i].block = COMPRESSED_NO_BLOCK;
+			compressed->decoded[i].dirty = 0;
+		}
+		else if (compressed->decoded[i].block != COMPRESSED_NO_BLOCK && compressed->decoded[i].block > position)
+		{
+			compressed->decoded[i].block--;
+		}
+	}
+}
+
+/*
+ * The last block is checked first since appends keep coming back to it;
+ * otherwise the walk over block counts starts at the block found last when
+ * that one comes before the index.
+ */
+static size_t FindBlock(ListCompressed* compressed, size_t index, size_t* offset)
+{
+	size_t lastPosition = compressed->blockCount - 1;
+	size_t lastIndex = compressed->count - compressed->blocks[lastPosition].count;
+
+	if (index >= lastIndex)
+	{
+		*offset = index - lastIndex;
+
+		return lastPosition;
+	}
+
+	size_t position = 0;
+	size_t firstIndex = 0;
+
+	if (compressed->cursorIndex <= index)
+	{
+		position = compressed->cursorBlock;
+		firstIndex = compressed->cursorIndex;
+	}
+
+	while (index >= firstIndex + compressed->blocks[position].count)
+	{
+		firstIndex += compressed->blocks[position].count;
+		position++;
+	}
+
+	compressed->cursorBlock = position;
+	compressed->cursorIndex = firstIndex;
+	*offset = index - firstIndex;
+
+	return position;
+}
+
+static int ClearCompressed(void* storage)
+{
+	ListCompressed* compressed = storage;
+
+	for (size_t i = 0; i < compressed->blockCount; i++)
+	{
+		FreeWords(compressed, &compressed->blocks[i]);
+	}
+
+	for (size_t i = 0; i < COMPRESSED_DECODED_BLOCKS; i++)
+	{
+		compressed->decoded[i].block = COMPRESSED_NO_BLOCK;
+		compressed->decoded[i].dirty = 0;
+	}
+
+	compressed->blockCount = 0;
+	compressed->count = 0;
+	compressed->cursorBlock = 0;
+	compressed->cursorIndex = 0;
+
+	return 0;
+}
+
+static void DestroyCompressed(void* storage)
+{
+	ListCompressed* compressed = storage;
+
+	ClearCompressed(compressed);
+
+	if (compressed->blocks != NULL)
+	{
+		compressed->allocator.free(compressed->allocator.ctx, compressed->blocks,
+			compressed->blockCapacity * sizeof(ListCompressedBlock));
+	}
+
+	compressed->allocator.free(compressed->allocator.ctx, compressed->decoded[0].items,
+		COMPRESSED_DECODED_BLOCKS * COMPRESSED_BLOCK_ITEMS * compressed->dataSize);
+	compressed->allocator.free(compressed->allocator.ctx, compressed, sizeof(ListCompressed));
+}
+
+static size_t CountCompressed(void* storage)
+{
+	return ((ListCompressed*)storage)->count;
+}
+
+/*
+ * A full block is split in half before the insertion, so a block never
+ * holds more than COMPRESSED_BLOCK_ITEMS items.
+ */
+static int InsertItem(ListCompressed* compressed, size_t position, size_t offset, const void* item)
+{
+	ListDecodedBlock* decoded = LoadBlock(compressed, position);
+
+	if (decoded == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	if (compressed->blocks[position].count == COMPRESSED_BLOCK_ITEMS)
+	{
+		size_t half = COMPRESSED_BLOCK_ITEMS / 2;
+
+		if (InsertBlock(compressed, position + 1) != 0 || EncodeBlock(compressed, &compressed->blocks[position + 1],
+			GetDecodedSlot(compressed, decoded, half), COMPRESSED_BLOCK_ITEMS - half) != 0)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		compressed->blocks[position].count = half;
+		decoded->dirty = 1;
+
+		if (offset > half)
+		{
+			offset -= half;
+			position++;
+			decoded = LoadBlock(compressed, position);
+
+			if (decoded == NULL)
+			{
+				return ERROR_ELEMENT_NULL;
+			}
+		}
+	}
+
+	ListCompressedBlock* block = &compressed->blocks[position];
+
+	memmove(GetDecodedSlot(compressed, decoded, offset + 1), GetDecodedSlot(compressed, decoded, offset),
+		(block->count - offset) * compressed->dataSize);
+	memcpy(GetDecodedSlot(compressed, decoded, offset), item, compressed->dataSize);
+	block->count++;
+	decoded->dirty = 1;
+	compressed->count++;
+	compressed->cursorBlock = 0;
+	compressed->cursorIndex = 0;
+
+	return 0;
+}
+
+static int PushCompressedFront(void* storage, const void* item)
+{
+	ListCompressed* compressed = storage;
+
+	if ((compressed->blockCount == 0 || compressed->blocks[0].count == COMPRESSED_BLOCK_ITEMS) &&
+		InsertBlock(compressed, 0) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	return InsertItem(compressed, 0, 0, item);
+}
+
+static int PushCompressedBack(void* storage, const void* item)
+{
+	ListCompressed* compressed = storage;
+
+	if ((compressed->blockCount == 0 || compressed->blocks[compressed->blockCount - 1].count == COMPRESSED_BLOCK_ITEMS) &&
+		InsertBlock(compressed, compressed->blockCount) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	size_t position = compressed->blockCount - 1;
+
+	return InsertItem(compressed, position, compressed->blocks[position].count, item);
+}
+
+static int PushCompressedAt(void* storage, size_t index, const void* item)
+{
+	ListCompressed* compressed = storage;
+
+	if (index == 0)
+	{
+		return PushCompressedFront(compressed, item);
+	}
+	if (index == compressed->count)
+	{
+		return PushCompressedBack(compressed, item);
+	}
+
+	size_t offset = 0;
+	size_t position = FindBlock(compressed, index, &offset);
+
+	return InsertItem(compressed, position, offset, item);
+}
+
+static int PopCompressedAt(void* storage, size_t index)
+{
+	ListCompressed* compressed = storage;
+	size_t offset = 0;
+	size_t position = FindBlock(compressed, index, &offset);
+	ListDecodedBlock* decoded = LoadBlock(compressed, position);
+
+	if (decoded == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	ListCompressedBlock* block = &compressed->blocks[position];
+
+	memmove(GetDecodedSlot(compressed, decoded, offset), GetDecodedSlot(compressed, decoded, offset + 1),
+		(block->count - offset - 1) * compressed->dataSize);
+	block->count--;
+	decoded->dirty = 1;
+	compressed->count--;
+	compressed->cursorBlock = 0;
+	compressed->cursorIndex = 0;
+
+	if (block->count == 0)
+	{
+		RemoveBlock(compressed, position);
+	}
+
+	return 0;
+}
+
+static int PopCompressedFront(void* storage)
+{
+	return PopCompressedAt(storage, 0);
+}
+
+static int PopCompressedBack(void* storage)
+{
+	ListCompressed* compressed = storage;
+
+	return PopCompressedAt(compressed, compressed->count - 1);
+}
+
+static int ReplaceCompressedItem(void* storage, size_t index, const void* item)
+{
+	ListCompressed* compressed = storage;
+	size_t offset = 0;
+	ListDecodedBlock* decoded = LoadBlock(compressed, FindBlock(compressed, index, &offset));
+
+	if (decoded == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	memcpy(GetDecodedSlot(compressed, decoded, offset), item, compressed->dataSize);
+	decoded->dirty = 1;
+
+	return 0;
+}
+
+static void* GetCompressedItem(void* storage, size_t index)
+{
+	ListCompressed* compressed = storage;
+	size_t offset = 0;
+	ListDecodedBlock* decoded = LoadBlock(compressed, FindBlock(compressed, index, &offset));
+
+	if (decoded == NULL)
+	{
+		return NULL;
+	}
+
+	return GetDecodedSlot(compressed, decoded, offset);
+}
+
+const ListStorage ListCompressedStorage = {
+	DestroyCompressed,
+	CountCompressed,
+	PushCompressedFront,
+	PushCompressedBack,
+	PushCompressedAt,
+	PopCompressedFront,
+	PopCompressedBack,
+	PopCompressedAt,
+	ReplaceCompressedItem,
+	ClearCompressed,
+	GetCompressedItem,
+	NULL,
+	NULL,
+	NULL,
+	1,
+};
@@ -0,0 +1,359 @@
+#include "ListStorage.h"
+#include <string.h>
+
+#define DEQUE_BLOCK_BYTES 4096
+#define DEQUE_MINIMUM_BLOCK_CAPACITY 16
+#define DEQUE_MINIMUM_MAP_CAPACITY 8
+
+/*
+ * Items live in fixed-size blocks that never move. The map holds the block
+ * pointers with free slots on both sides, so pushing at either end only adds
+ * a block and an index is a shift and a mask away from its slot.
+ */
+typedef struct ListDeque
+{
+	unsigned char** map;
+	size_t mapCapacity;
+	size_t firstBlock;
+	size_t blockCount;
+	size_t blockShift;
+	size_t start;
+	size_t count;
+	size_t dataSize;
+	ListAllocator allocator;
+} ListDeque;
+
+static size_t GetBlockCapacity(ListDeque* deque)
+{
+	return (size_t)1 << deque->blockShift;
+}
+
+static unsigned char* GetSlot(ListDeque* deque, size_t index)
+{
+	size_t position = deque->start + index;
+	unsigned char* block = deque->map[deque->firstBlock + (position >> deque->blockShift)];
+
+	return block + (position & (GetBlockCapacity(deque) - 1)) * deque->dataSize;
+}
+
+void* ListDequeCreate(size_t dataSize, const ListAllocator* allocator)
+{
+	ListDeque* deque = allocator->alloc(allocator->ctx, sizeof(ListDeque));
+
+	if (deque == NULL)
+	{
+		return NULL;
+	}
+
+	deque->blockShift = 0;
+
+	while (((size_t)2 << deque->blockShift) * dataSize <= DEQUE_BLOCK_BYTES ||
+		   ((size_t)1 << deque->blockShift) < DEQUE_MINIMUM_BLOCK_CAPACITY)
+	{
+		deque->blockShift++;
+	}
+
+	deque->map = NULL;
+	deque->mapCapacity = 0;
+	deque->firstBlock = 0;
+	deque->blockCount = 0;
+	deque->start = 0;
+	deque->count = 0;
+	deque->dataSize = dataSize;
+	deque->allocator = *allocator;
+
+	return deque;
+}
+
+static size_t GetBlockBytes(ListDeque* deque)
+{
+	return GetBlockCapacity(deque) * deque->dataSize;
+}
+
+static int ClearDeque(void* storage)
+{
+	ListDeque* deque = storage;
+
+	for (size_t i = 0; i < deque->blockCount; i++)
+	{
+		deque->allocator.free(deque->allocator.ctx, deque->map[deque->firstBlock + i], GetBlockBytes(deque));
+	}
+
+	deque->firstBlock = deque->mapCapacity / 2;
+	deque->blockCount = 0;
+	deque->start = 0;
+	deque->count = 0;
+
+	return 0;
+}
+
+static void DestroyDeque(void* storage)
+{
+	ListDeque* deque = storage;
+
+	ClearDeque(deque);
+
+	if (deque->map != NULL)
+	{
+		deque->allocator.free(deque->allocator.ctx, deque->map, deque->mapCapacity * sizeof(unsigned char*));
+	}
+
+	deque->allocator.free(deque->allocator.ctx, deque, sizeof(ListDeque));
+}
+
+static size_t CountDeque(void* storage)
+{
+	return ((ListDeque*)storage)->count;
+}
+
+static int ReserveMap(ListDeque* deque, int front)
+{
+	if (front ? deque->firstBlock > 0 : deque->firstBlock + deque->blockCount < deque->mapCapacity)
+	{
+		return 0;
+	}
+
+	size_t mapCapacity = deque->blockCount * 2 + 2;
+
+	if (mapCapacity < DEQUE_MINIMUM_MAP_CAPACITY)
+	{
+		mapCapacity = DEQUE_MINIMUM_MAP_CAPACITY;
+	}
+
+	unsigned char** map = deque->allocator.alloc(deque->allocator.ctx, mapCapacity * sizeof(unsigned char*));
+
+	if (map == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	size_t firstBlock = (mapCapacity - deque->blockCount) / 2;
+
+	if (deque->blockCount > 0)
+	{
+		memcpy(map + firstBlock, deque->map + deque->firstBlock, deque->blockCount * sizeof(unsigned char*));
+	}
+	if (deque->map != NULL)
+	{
+		deque->allocator.free(deque->allocator.ctx, deque->map, deque->mapCapacity * sizeof(unsigned char*));
+	}
+
+	deque->map = map;
+	deque->mapCapacity = mapCapacity;
+	deque->firstBlock = firstBlock;
+
+	return 0;
+}
+
+static int AddBlock(ListDeque* deque, int front)
+{
+	if (ReserveMap(deque, front) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	unsigned char* block = deque->allocator.alloc(deque->allocator.ctx, GetBlockBytes(deque));
+
+	if (block == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	if (front)
+	{
+		deque->firstBlock--;
+		deque->start += GetBlockCapacity(deque);
+		deque->map[deque->firstBlock] = block;
+	}
+	else
+	{
+		deque->map[deque->firstBlock + deque->blockCount] = block;
+	}
+
+	deque->blockCount++;
+
+	return 0;
+}
+
+static void RemoveBlock(ListDeque* deque, int front)
+{
+	size_t blockIndex = front ? deque->firstBlock : deque->firstBlock + deque->blockCount - 1;
+
+	deque->allocator.free(deque->allocator.ctx, deque->map[blockIndex], GetBlockBytes(deque));
+
+	if (front)
+	{
+		deque->firstBlock++;
+		deque->start -= GetBlockCapacity(deque);
+	}
+
+	deque->blockCount--;
+}
+
+static int PushDequeFront(void* storage, const void* item)
+{
+	ListDeque* deque = storage;
+
+	if (deque->start == 0 && AddBlock(deque, 1) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	deque->start--;
+	deque->count++;
+
+	memcpy(GetSlot(deque, 0), item, deque->dataSize);
+
+	return 0;
+}
+
+static int PushDequeBack(void* storage, const void* item)
+{
+	ListDeque* deque = storage;
+
+	if (deque->start + deque->count == deque->blockCount * GetBlockCapacity(deque) && AddBlock(deque, 0) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	deque->count++;
+
+	memcpy(GetSlot(deque, deque->count - 1), item, deque->dataSize);
+
+	return 0;
+}
+
+static int PopDequeFront(void* storage)
+{
+	ListDeque* deque = storage;
+
+	deque->start++;
+	deque->count--;
+
+	if (deque->count == 0)
+	{
+		ClearDeque(deque);
+	}
+	else if (deque->start == GetBlockCapacity(deque))
+	{
+		RemoveBlock(deque, 1);
+	}
+
+	return 0;
+}
+
+static int PopDequeBack(void* storage)
+{
+	ListDeque* deque = storage;
+
+	deque->count--;
+
+	if (deque->count == 0)
+	{
+		ClearDeque(deque);
+	}
+	else if (deque->start + deque->count <= (deque->blockCount - 1) * GetBlockCapacity(deque))
+	{
+		RemoveBlock(deque, 0);
+	}
+
+	return 0;
+}
+
+static void MoveItem(ListDeque* deque, size_t destination, size_t source)
+{
+	memcpy(GetSlot(deque, destination), GetSlot(deque, source), deque->dataSize);
+}
+
+static int PushDequeAt(void* storage, size_t index, const void* item)
+{
+	ListDeque* deque = storage;
+
+	if (index == deque->count)
+	{
+		return PushDequeBack(deque, item);
+	}
+
+	if (index < deque->count / 2)
+	{
+		if (PushDequeFront(deque, GetSlot(deque, 0)) != 0)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		for (size_t i = 1; i < index; i++)
+		{
+			MoveItem(deque, i, i + 1);
+		}
+	}
+	else
+	{
+		if (PushDequeBack(deque, GetSlot(deque, deque->count - 1)) != 0)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		for (size_t i = deque->count - 2; i > index; i--)
+		{
+			MoveItem(deque, i, i - 1);
+		}
+	}
+
+	memcpy(GetSlot(deque, index), item, deque->dataSize);
+
+	return 0;
+}
+
+static int PopDequeAt(void* storage, size_t index)
+{
+	ListDeque* deque = storage;
+
+	if (index < deque->count / 2)
+	{
+		for (size_t i = index; i > 0; i--)
+		{
+			MoveItem(deque, i, i - 1);
+		}
+
+		return PopDequeFront(deque);
+	}
+
+	for (size_t i = index; i + 1 < deque->count; i++)
+	{
+		MoveItem(deque, i, i + 1);
+	}
+
+	return PopDequeBack(deque);
+}
+
+static int ReplaceDequeItem(void* storage, size_t index, const void* item)
+{
+	ListDeque* deque = storage;
+
+	memcpy(GetSlot(deque, index), item, deque->dataSize);
+
+	return 0;
+}
+
+static void* GetDequeItem(void* storage, size_t index)
+{
+	return GetSlot(storage, index);
+}
+
+const ListStorage ListDequeStorage = {
+	DestroyDeque,
+	CountDeque,
+	PushDequeFront,
+	PushDequeBack,
+	PushDequeAt,
+	PopDequeFront,
+	PopDequeBack,
+	PopDequeAt,
+	ReplaceDequeItem,
+	ClearDeque,
+	GetDequeItem,
+	NULL,
+	NULL,
+	NULL,
+	0,
+};
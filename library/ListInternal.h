@@ -0,0 +1,16 @@
+#ifndef LISTINTERNAL_H
+#define LISTINTERNAL_H
+
+#include "LinkedList/LinkedList.h"
+#include <stddef.h>
+
+#define LIST_CACHE_LINE 64
+
+/*
+ * Like ListInitialise, but the list header starts on a cache line and is
+ * padded to whole cache lines, so lists that different threads write are
+ * never split across a shared line. ListDestroy releases it as usual.
+ */
+LinkedList* ListInitialiseCacheAligned(size_t dataSize);
+
+#endif
@@ -0,0 +1,257 @@
+#include "ListStorage.h"
+#include <stdint.h>
+#include <string.h>
+
+#define RING_CACHE_LINE 64
+
+/*
+ * The consumer owns head and the producer owns tail. Each index shares its
+ * cache line only with the owner's cached copy of the other index, so the
+ * two threads touch each other's line only when the cached copy runs out.
+ */
+typedef struct ListRing
+{
+	unsigned char* slots;
+	size_t mask;
+	size_t dataSize;
+	ListAllocator allocator;
+	void* memory;
+	size_t memorySize;
+	unsigned char readOnlyPadding[RING_CACHE_LINE];
+
+	size_t head;
+	size_t cachedTail;
+	unsigned char headPadding[RING_CACHE_LINE - 2 * sizeof(size_t)];
+
+	size_t tail;
+	size_t cachedHead;
+	unsigned char tailPadding[RING_CACHE_LINE - 2 * sizeof(size_t)];
+} ListRing;
+
+void* ListRingCreate(size_t dataSize, size_t capacity, const ListAllocator* allocator)
+{
+	// Doubling past the largest power of two would wrap slotCount to 0 and never stop.
+	if (capacity > (SIZE_MAX >> 1) + 1)
+	{
+		return NULL;
+	}
+
+	size_t slotCount = 1;
+
+	while (slotCount < capacity)
+	{
+		slotCount *= 2;
+	}
+
+	size_t slotsOffset = (sizeof(ListRing) + RING_CACHE_LINE - 1) / RING_CACHE_LINE * RING_CACHE_LINE;
+
+	if (slotCount > (SIZE_MAX - RING_CACHE_LINE - slotsOffset) / dataSize)
+	{
+		return NULL;
+	}
+
+	size_t memorySize = RING_CACHE_LINE + slotsOffset + slotCount * dataSize;
+	unsigned char* memory = allocator->alloc(allocator->ctx, memorySize);
+
+	if (memory == NULL)
+	{
+		return NULL;
+	}
+
+	uintptr_t address = ((uintptr_t)memory + RING_CACHE_LINE - 1) & ~(uintptr_t)(RING_CACHE_LINE - 1);
+	ListRing* ring = (ListRing*)address;
+
+	ring->slots = (unsigned char*)address + slotsOffset;
+	ring->mask = slotCount - 1;
+	ring->dataSize = dataSize;
+	ring->allocator = *allocator;
+	ring->memory = memory;
+	ring->memorySize = memorySize;
+	ring->head = 0;
+	ring->cachedTail = 0;
+	ring->tail = 0;
+	ring->cachedHead = 0;
+
+	return ring;
+}
+
+static void DestroyRing(void* storage)
+{
+	ListRing* ring = storage;
+
+	ring->allocator.free(ring->allocator.ctx, ring->memory, ring->memorySize);
+}
+
+static size_t CountRing(void* storage)
+{
+	ListRing* ring = storage;
+	size_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+	size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+	return tail - head;
+}
+
+static void CopyIn(ListRing* ring, size_t position, const unsigned char* items, size_t count)
+{
+	size_t slot = position & ring->mask;
+	size_t firstCount = ring->mask + 1 - slot;
+
+	if (firstCount > count)
+	{
+		firstCount = count;
+	}
+
+	memcpy(ring->slots + slot * ring->dataSize, items, firstCount * ring->dataSize);
+	memcpy(ring->slots, items + firstCount * ring->dataSize, (count - firstCount) * ring->dataSize);
+}
+
+static void CopyOut(ListRing* ring, size_t position, unsigned char* items, size_t count)
+{
+	size_t slot = position & ring->mask;
+	size_t firstCount = ring->mask + 1 - slot;
+
+	if (firstCount > count)
+	{
+		firstCount = count;
+	}
+
+	memcpy(items, ring->slots + slot * ring->dataSize, firstCount * ring->dataSize);
+	memcpy(items + firstCount * ring->dataSize, ring->slots, (count - firstCount) * ring->dataSize);
+}
+
+static size_t PushRingBackMany(void* storage, const void* items, size_t count)
+{
+	ListRing* ring = storage;
+	size_t tail = ring->tail;
+	size_t capacity = ring->mask + 1;
+
+	if (capacity - (tail - ring->cachedHead) < count)
+	{
+		ring->cachedHead = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+	}
+
+	size_t freeCount = capacity - (tail - ring->cachedHead);
+
+	if (count > freeCount)
+	{
+		count = freeCount;
+	}
+
+	CopyIn(ring, tail, items, count);
+	__atomic_store_n(&ring->tail, tail + count, __ATOMIC_RELEASE);
+
+	return count;
+}
+
+static size_t PopRingFrontMany(void* storage, void* items, size_t count)
+{
+	ListRing* ring = storage;
+	size_t head = ring->head;
+
+	if (ring->cachedTail - head < count)
+	{
+		ring->cachedTail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+	}
+
+	size_t usedCount = ring->cachedTail - head;
+
+	if (count > usedCount)
+	{
+		count = usedCount;
+	}
+
+	if (items != NULL)
+	{
+		CopyOut(ring, head, items, count);
+	}
+
+	__atomic_store_n(&ring->head, head + count, __ATOMIC_RELEASE);
+
+	return count;
+}
+
+static int PushRingBack(void* storage, const void* item)
+{
+	return PushRingBackMany(storage, item, 1) == 1 ? 0 : ERROR_LIST_FULL;
+}
+
+static int PopRingFront(void* storage)
+{
+	return PopRingFrontMany(storage, NULL, 1) == 1 ? 0 : ERROR_LIST_EMPTY;
+}
+
+static int PushRingFront(void* storage, const void* item)
+{
+	(void)storage;
+	(void)item;
+
+	return ERROR_INVALID_OPERATION;
+}
+
+static int PushRingAt(void* storage, size_t index, const void* item)
+{
+	(void)storage;
+	(void)index;
+	(void)item;
+
+	return ERROR_INVALID_OPERATION;
+}
+
+static int PopRingBack(void* storage)
+{
+	(void)storage;
+
+	return ERROR_INVALID_OPERATION;
+}
+
+static int PopRingAt(void* storage, size_t index)
+{
+	(void)storage;
+	(void)index;
+
+	return ERROR_INVALID_OPERATION;
+}
+
+static int ReplaceRingItem(void* storage, size_t index, const void* item)
+{
+	(void)storage;
+	(void)index;
+	(void)item;
+
+	return ERROR_INVALID_OPERATION;
+}
+
+static int ClearRing(void* storage)
+{
+	ListRing* ring = storage;
+
+	ring->cachedTail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+	__atomic_store_n(&ring->head, ring->cachedTail, __ATOMIC_RELEASE);
+
+	return 0;
+}
+
+static void* GetRingItem(void* storage, size_t index)
+{
+	ListRing* ring = storage;
+
+	return ring->slots + ((ring->head + index) & ring->mask) * ring->dataSize;
+}
+
+const ListStorage ListRingStorage = {
+	DestroyRing,
+	CountRing,
+	PushRingFront,
+	PushRingBack,
+	PushRingAt,
+	PopRingFront,
+	PopRingBack,
+	PopRingAt,
+	ReplaceRingItem,
+	ClearRing,
+	GetRingItem,
+	PushRingBackMany,
+	PopRingFrontMany,
+	NULL,
+	0,
+};
@@ -0,0 +1,138 @@
+#include "LinkedList/ListSharded.h"
+#include "ListInternal.h"
+#include <stdlib.h>
+
+/*
+ * Every shard is a plain list of its own that only one thread appends to, so
+ * pushing needs no synchronisation. Every push writes its shard's list header,
+ * and headers allocated back to back would share cache lines, so each one is
+ * cache-line aligned and padded to whole lines.
+ */
+typedef struct ListSharded
+{
+	LinkedList** shards;
+	size_t shardCount;
+	size_t dataSize;
+} ListSharded;
+
+ListSharded* ListShardedInitialise(size_t dataSize, size_t shardCount)
+{
+	if (dataSize == 0 || shardCount == 0)
+	{
+		return NULL;
+	}
+
+	ListSharded* sharded = malloc(sizeof(ListSharded));
+
+	if (sharded == NULL)
+	{
+		return NULL;
+	}
+
+	sharded->shards = calloc(shardCount, sizeof(LinkedList*));
+	sharded->shardCount = shardCount;
+	sharded->dataSize = dataSize;
+
+	if (sharded->shards == NULL)
+	{
+		free(sharded);
+
+		return NULL;
+	}
+
+	for (size_t i = 0; i < shardCount; i++)
+	{
+		sharded->shards[i] = ListInitialiseCacheAligned(dataSize);
+
+		if (sharded->shards[i] == NULL)
+		{
+			ListShardedDestroy(&sharded);
+
+			return NULL;
+		}
+	}
+
+	return sharded;
+}
+
+int ListShardedDestroy(ListSharded** sharded)
+{
+	if (sharded == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	if (*sharded == NULL)
+	{
+		return 0;
+	}
+
+	for (size_t i = 0; i < (*sharded)->shardCount; i++)
+	{
+		if ((*sharded)->shards[i] != NULL)
+		{
+			ListDestroy(&(*sharded)->shards[i]);
+		}
+	}
+
+	free((*sharded)->shards);
+	free(*sharded);
+	*sharded = NULL;
+
+	return 0;
+}
+
+size_t ListShardedCount(ListSharded* sharded)
+{
+	if (sharded == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	size_t count = 0;
+
+	for (size_t i = 0; i < sharded->shardCount; i++)
+	{
+		count += ListCount(sharded->shards[i]);
+	}
+
+	return count;
+}
+
+int ListShardedPushBack(ListSharded* sharded, size_t shard, void* item)
+{
+	if (sharded == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (shard >= sharded->shardCount)
+	{
+		return ERROR_INVALID_INDEX;
+	}
+
+	return ListPushBack(sharded->shards[shard], item);
+}
+
+/*
+ * Each shard is spliced behind the destination's tail, so collecting costs
+ * one step per shard however many items were pushed.
+ */
+int ListShardedCollect(ListSharded* sharded, LinkedList* destination)
+{
+	if (sharded == NULL || destination == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	for (size_t i = 0; i < sharded->shardCount; i++)
+	{
+		int result = ListConcatenate(destination, sharded->shards[i]);
+
+		if (result != 0)
+		{
+			return result;
+		}
+	}
+
+	return 0;
+}
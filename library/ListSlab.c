@@ -0,0 +1,497 @@
+#include "ListStorage.h"
+#include <stdint.h>
+#include <string.h>
+
+#define SLAB_CHUNK_SHIFT 12
+#define SLAB_CHUNK_CAPACITY ((size_t)1 << SLAB_CHUNK_SHIFT)
+#define SLAB_NONE UINT32_MAX
+#define SLAB_CURSOR_COUNT 2
+
+/*
+ * Nodes are numbered and live in chunks that never move: the links of a
+ * chunk are one array of 32-bit node numbers and its items another, so an
+ * element costs four bytes on top of its item and a walk only touches the
+ * link arrays. Removed nodes are chained through their links for reuse.
+ */
+typedef struct ListSlabCursor
+{
+	size_t index;
+	uint32_t node;
+} ListSlabCursor;
+
+typedef struct ListSlab
+{
+	uint32_t** links;
+	unsigned char** items;
+	size_t chunkCount;
+	size_t chunkCapacity;
+	size_t nodeCount;
+	uint32_t head;
+	uint32_t tail;
+	uint32_t freeHead;
+	size_t count;
+	ListSlabCursor cursors[SLAB_CURSOR_COUNT];
+	size_t lastCursor;
+	size_t dataSize;
+	ListAllocator allocator;
+} ListSlab;
+
+static uint32_t* GetNextLink(ListSlab* slab, uint32_t node)
+{
+	return &slab->links[node >> SLAB_CHUNK_SHIFT][node & (SLAB_CHUNK_CAPACITY - 1)];
+}
+
+static unsigned char* GetSlot(ListSlab* slab, uint32_t node)
+{
+	return slab->items[node >> SLAB_CHUNK_SHIFT] + (node & (SLAB_CHUNK_CAPACITY - 1)) * slab->dataSize;
+}
+
+void* ListSlabCreate(size_t dataSize, const ListAllocator* allocator)
+{
+	ListSlab* slab = allocator->alloc(allocator->ctx, sizeof(ListSlab));
+
+	if (slab == NULL)
+	{
+		return NULL;
+	}
+
+	slab->links = NULL;
+	slab->items = NULL;
+	slab->chunkCount = 0;
+	slab->chunkCapacity = 0;
+	slab->nodeCount = 0;
+	slab->head = SLAB_NONE;
+	slab->tail = SLAB_NONE;
+	slab->freeHead = SLAB_NONE;
+	slab->count = 0;
+	slab->lastCursor = 0;
+	slab->dataSize = dataSize;
+	slab->allocator = *allocator;
+
+	for (size_t i = 0; i < SLAB_CURSOR_COUNT; i++)
+	{
+		slab->cursors[i].node = SLAB_NONE;
+	}
+
+	return slab;
+}
+
+static int ClearSlab(void* storage)
+{
+	ListSlab* slab = storage;
+
+	for (size_t i = 0; i < slab->chunkCount; i++)
+	{
+		slab->allocator.free(slab->allocator.ctx, slab->links[i], SLAB_CHUNK_CAPACITY * sizeof(uint32_t));
+		slab->allocator.free(slab->allocator.ctx, slab->items[i], SLAB_CHUNK_CAPACITY * slab->dataSize);
+	}
+
+	slab->chunkCount = 0;
+	slab->nodeCount = 0;
+	slab->head = SLAB_NONE;
+	slab->tail = SLAB_NONE;
+	slab->freeHead = SLAB_NONE;
+	slab->count = 0;
+
+	for (size_t i = 0; i < SLAB_CURSOR_COUNT; i++)
+	{
+		slab->cursors[i].node = SLAB_NONE;
+	}
+
+	return 0;
+}
+
+static void DestroySlab(void* storage)
+{
+	ListSlab* slab = storage;
+
+	ClearSlab(slab);
+
+	if (slab->links != NULL)
+	{
+		slab->allocator.free(slab->allocator.ctx, slab->links, slab->chunkCapacity * sizeof(uint32_t*));
+		slab->allocator.free(slab->allocator.ctx, slab->items, slab->chunkCapacity * sizeof(unsigned char*));
+	}
+
+	slab->allocator.free(slab->allocator.ctx, slab, sizeof(ListSlab));
+}
+
+static size_t CountSlab(void* storage)
+{
+	return ((ListSlab*)storage)->count;
+}
+
+static int ReserveChunks(ListSlab* slab)
+{
+	if (slab->chunkCount < slab->chunkCapacity)
+	{
+		return 0;
+	}
+
+	size_t chunkCapacity = slab->chunkCapacity == 0 ? 8 : slab->chunkCapacity * 2;
+	uint32_t** links = slab->allocator.alloc(slab->allocator.ctx, chunkCapacity * sizeof(uint32_t*));
+	unsigned char** items = slab->allocator.alloc(slab->allocator.ctx, chunkCapacity * sizeof(unsigned char*));
+
+	if (links == NULL || items == NULL)
+	{
+		if (links != NULL)
+		{
+			slab->allocator.free(slab->allocator.ctx, links, chunkCapacity * sizeof(uint32_t*));
+		}
+		if (items != NULL)
+		{
+			slab->allocator.free(slab->allocator.ctx, items, chunkCapacity * sizeof(unsigned char*));
+		}
+
+		return ERROR_ELEMENT_NULL;
+	}
+
+	if (slab->links != NULL)
+	{
+		memcpy(links, slab->links, slab->chunkCount * sizeof(uint32_t*));
+		memcpy(items, slab->items, slab->chunkCount * sizeof(unsigned char*));
+		slab->allocator.free(slab->allocator.ctx, slab->links, slab->chunkCapacity * sizeof(uint32_t*));
+		slab->allocator.free(slab->allocator.ctx, slab->items, slab->chunkCapacity * sizeof(unsigned char*));
+	}
+
+	slab->links = links;
+	slab->items = items;
+	slab->chunkCapacity = chunkCapacity;
+
+	return 0;
+}
+
+static int AddChunk(ListSlab* slab)
+{
+	if (ReserveChunks(slab) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	uint32_t* links = slab->allocator.alloc(slab->allocator.ctx, SLAB_CHUNK_CAPACITY * sizeof(uint32_t));
+	unsigned char* items = slab->allocator.alloc(slab->allocator.ctx, SLAB_CHUNK_CAPACITY * slab->dataSize);
+
+	if (links == NULL || items == NULL)
+	{
+		if (links != NULL)
+		{
+			slab->allocator.free(slab->allocator.ctx, links, SLAB_CHUNK_CAPACITY * sizeof(uint32_t));
+		}
+		if (items != NULL)
+		{
+			slab->allocator.free(slab->allocator.ctx, items, SLAB_CHUNK_CAPACITY * slab->dataSize);
+		}
+
+		return ERROR_ELEMENT_NULL;
+	}
+
+	slab->links[slab->chunkCount] = links;
+	slab->items[slab->chunkCount] = items;
+	slab->chunkCount++;
+
+	return 0;
+}
+
+static uint32_t CreateNode(ListSlab* slab, const void* item, uint32_t next)
+{
+	uint32_t node = slab->freeHead;
+
+	if (node != SLAB_NONE)
+	{
+		slab->freeHead = *GetNextLink(slab, node);
+	}
+	else
+	{
+		if (slab->nodeCount == SLAB_NONE)
+		{
+			return SLAB_NONE;
+		}
+		if (slab->nodeCount == slab->chunkCount * SLAB_CHUNK_CAPACITY && AddChunk(slab) != 0)
+		{
+			return SLAB_NONE;
+		}
+
+		node = (uint32_t)slab->nodeCount++;
+	}
+
+	memcpy(GetSlot(slab, node), item, slab->dataSize);
+	*GetNextLink(slab, node) = next;
+	slab->count++;
+
+	return node;
+}
+
+static void FreeNode(ListSlab* slab, uint32_t node)
+{
+	*GetNextLink(slab, node) = slab->freeHead;
+	slab->freeHead = node;
+	slab->count--;
+}
+
+/*
+ * The last nodes found are remembered, so visiting the items in order walks
+ * the list once instead of once per item. There are two cursors, so moving
+ * items towards the front, which reads ahead of where it writes, walks the
+ * list once as well.
+ */
+static uint32_t FindNode(ListSlab* slab, size_t index)
+{
+	ListSlabCursor* cursor = NULL;
+
+	for (size_t i = 0; i < SLAB_CURSOR_COUNT; i++)
+	{
+		ListSlabCursor* candidate = &slab->cursors[i];
+
+		if (candidate->node != SLAB_NONE && candidate->index <= index &&
+			(cursor == NULL || candidate->index > cursor->index))
+		{
+			cursor = candidate;
+		}
+	}
+
+	size_t position = 0;
+	uint32_t node = slab->head;
+
+	if (cursor != NULL)
+	{
+		position = cursor->index;
+		node = cursor->node;
+	}
+	else
+	{
+		cursor = &slab->cursors[(slab->lastCursor + 1) % SLAB_CURSOR_COUNT];
+	}
+
+	for (; position < index; position++)
+	{
+		node = *GetNextLink(slab, node);
+	}
+
+	cursor->index = index;
+	cursor->node = node;
+	slab->lastCursor = (size_t)(cursor - slab->cursors);
+
+	return node;
+}
+
+/*
+ * Keeps the cursors on their nodes when a node is inserted or removed at
+ * index, and drops a cursor on a removed node.
+ */
+static void MoveCursors(ListSlab* slab, size_t index, int inserted)
+{
+	for (size_t i = 0; i < SLAB_CURSOR_COUNT; i++)
+	{
+		ListSlabCursor* cursor = &slab->cursors[i];
+
+		if (cursor->node == SLAB_NONE || cursor->index < index)
+		{
+			continue;
+		}
+
+		if (inserted)
+		{
+			cursor->index++;
+		}
+		else if (cursor->index == index)
+		{
+			cursor->node = SLAB_NONE;
+		}
+		else
+		{
+			cursor->index--;
+		}
+	}
+}
+
+static int PushSlabFront(void* storage, const void* item)
+{
+	ListSlab* slab = storage;
+	uint32_t node = CreateNode(slab, item, slab->head);
+
+	if (node == SLAB_NONE)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	if (slab->tail == SLAB_NONE)
+	{
+		slab->tail = node;
+	}
+
+	slab->head = node;
+	MoveCursors(slab, 0, 1);
+
+	return 0;
+}
+
+static int PushSlabBack(void* storage, const void* item)
+{
+	ListSlab* slab = storage;
+
+	if (slab->tail == SLAB_NONE)
+	{
+		return PushSlabFront(slab, item);
+	}
+
+	uint32_t node = CreateNode(slab, item, SLAB_NONE);
+
+	if (node == SLAB_NONE)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	*GetNextLink(slab, slab->tail) = node;
+	slab->tail = node;
+
+	return 0;
+}
+
+static int PushSlabAt(void* storage, size_t index, const void* item)
+{
+	ListSlab* slab = storage;
+
+	if (index == 0)
+	{
+		return PushSlabFront(slab, item);
+	}
+	if (index == slab->count)
+	{
+		return PushSlabBack(slab, item);
+	}
+
+	uint32_t previous = FindNode(slab, index - 1);
+	uint32_t node = CreateNode(slab, item, *GetNextLink(slab, previous));
+
+	if (node == SLAB_NONE)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	*GetNextLink(slab, previous) = node;
+	MoveCursors(slab, index, 1);
+
+	return 0;
+}
+
+static int PopSlabFront(void* storage)
+{
+	ListSlab* slab = storage;
+	uint32_t node = slab->head;
+
+	slab->head = *GetNextLink(slab, node);
+
+	if (slab->head == SLAB_NONE)
+	{
+		slab->tail = SLAB_NONE;
+	}
+
+	MoveCursors(slab, 0, 0);
+	FreeNode(slab, node);
+
+	return 0;
+}
+
+static int PopSlabAt(void* storage, size_t index)
+{
+	ListSlab* slab = storage;
+
+	if (index == 0)
+	{
+		return PopSlabFront(slab);
+	}
+
+	uint32_t previous = FindNode(slab, index - 1);
+	uint32_t node = *GetNextLink(slab, previous);
+
+	*GetNextLink(slab, previous) = *GetNextLink(slab, node);
+
+	if (node == slab->tail)
+	{
+		slab->tail = previous;
+	}
+
+	MoveCursors(slab, index, 0);
+	FreeNode(slab, node);
+
+	return 0;
+}
+
+static int PopSlabBack(void* storage)
+{
+	ListSlab* slab = storage;
+
+	return PopSlabAt(slab, slab->count - 1);
+}
+
+/*
+ * Dropping the items behind count in one walk keeps bulk removals linear;
+ * popping them from the back one by one would walk from the head each time.
+ */
+static int TruncateSlab(void* storage, size_t count)
+{
+	ListSlab* slab = storage;
+
+	if (count == 0)
+	{
+		return ClearSlab(slab);
+	}
+
+	uint32_t last = FindNode(slab, count - 1);
+	uint32_t node = *GetNextLink(slab, last);
+
+	*GetNextLink(slab, last) = SLAB_NONE;
+	slab->tail = last;
+
+	while (node != SLAB_NONE)
+	{
+		uint32_t next = *GetNextLink(slab, node);
+
+		FreeNode(slab, node);
+		node = next;
+	}
+
+	for (size_t i = 0; i < SLAB_CURSOR_COUNT; i++)
+	{
+		if (slab->cursors[i].index >= count)
+		{
+			slab->cursors[i].node = SLAB_NONE;
+		}
+	}
+
+	return 0;
+}
+
+static int ReplaceSlabItem(void* storage, size_t index, const void* item)
+{
+	ListSlab* slab = storage;
+
+	memcpy(GetSlot(slab, FindNode(slab, index)), item, slab->dataSize);
+
+	return 0;
+}
+
+static void* GetSlabItem(void* storage, size_t index)
+{
+	ListSlab* slab = storage;
+
+	return GetSlot(slab, FindNode(slab, index));
+}
+
+const ListStorage ListSlabStorage = {
+	DestroySlab,
+	CountSlab,
+	PushSlabFront,
+	PushSlabBack,
+	PushSlabAt,
+	PopSlabFront,
+	PopSlabBack,
+	PopSlabAt,
+	ReplaceSlabItem,
+	ClearSlab,
+	GetSlabItem,
+	NULL,
+	NULL,
+	TruncateSlab,
+	0,
+};
@@ -0,0 +1,43 @@
+#ifndef LISTSTORAGE_H
+#define LISTSTORAGE_H
+
+#include "LinkedList/LinkedList.h"
+#include <stddef.h>
+
+/*
+ * A pointer returned by getItem stays valid at least until the next call.
+ * Backends that set transientItems may reuse its memory after that, so
+ * callers that hold several item pointers at once must copy the items.
+ */
+typedef struct ListStorage
+{
+	void (*destroy)(void* storage);
+	size_t (*count)(void* storage);
+	int (*pushFront)(void* storage, const void* item);
+	int (*pushBack)(void* storage, const void* item);
+	int (*pushAt)(void* storage, size_t index, const void* item);
+	int (*popFront)(void* storage);
+	int (*popBack)(void* storage);
+	int (*popAt)(void* storage, size_t index);
+	int (*replace)(void* storage, size_t index, const void* item);
+	int (*clear)(void* storage);
+	void* (*getItem)(void* storage, size_t index);
+	size_t (*pushBackMany)(void* storage, const void* items, size_t count);
+	size_t (*popFrontMany)(void* storage, void* items, size_t count);
+	int (*truncate)(void* storage, size_t count);
+	int transientItems;
+} ListStorage;
+
+extern const ListStorage ListDequeStorage;
+extern const ListStorage ListRingStorage;
+extern const ListStorage ListSlabStorage;
+extern const ListStorage ListTieredStorage;
+extern const ListStorage ListCompressedStorage;
+
+void* ListDequeCreate(size_t dataSize, const ListAllocator* allocator);
+void* ListRingCreate(size_t dataSize, size_t capacity, const ListAllocator* allocator);
+void* ListSlabCreate(size_t dataSize, const ListAllocator* allocator);
+void* ListTieredCreate(size_t dataSize, const char* path, size_t memoryBudget, const ListAllocator* allocator);
+void* ListCompressedCreate(size_t dataSize, const ListAllocator* allocator);
+
+#endif
@@ -0,0 +1,769 @@
+#include "ListStorage.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#define TIER_SEGMENT_BYTES ((size_t)64 << 10)
+#define TIER_MINIMUM_RESIDENT_SEGMENTS 2
+#define TIER_NOT_SPILLED ((off_t)-1)
+
+/*
+ * Items live in segments of TIER_SEGMENT_BYTES, with free slots on either
+ * side of the used ones so pushing at an end does not move items. Popping at
+ * an end only changes start and count, so the spilled copy stays valid.
+ */
+typedef struct ListTierSegment
+{
+	unsigned char* items;
+	size_t start;
+	size_t count;
+	off_t fileOffset;
+	int dirty;
+	struct ListTierSegment* newer;
+	struct ListTierSegment* older;
+} ListTierSegment;
+
+/*
+ * At most residentLimit segments are held in memory. A segment that is used
+ * becomes the newest in the resident chain, and making room writes the oldest
+ * one to its slot in the spill file, unless it is unchanged since it was
+ * read back. Pushes and pops at the ends keep the first and last segments
+ * fresh, so it is the middle of a long queue that ends up on disk.
+ */
+typedef struct ListTiered
+{
+	ListTierSegment** segments;
+	size_t segmentCount;
+	size_t segmentCapacity;
+	size_t segmentItems;
+	size_t count;
+	ListTierSegment* newest;
+	ListTierSegment* oldest;
+	size_t residentCount;
+	size_t residentLimit;
+	off_t* freeOffsets;
+	size_t freeOffsetCount;
+	size_t freeOffsetCapacity;
+	off_t fileSize;
+	int file;
+	size_t cursorPosition;
+	size_t cursorIndex;
+	size_t dataSize;
+	ListAllocator allocator;
+} ListTiered;
+
+static size_t GetSegmentBytes(ListTiered* tiered)
+{
+	return tiered->segmentItems * tiered->dataSize;
+}
+
+static unsigned char* GetSlot(ListTiered* tiered, ListTierSegment* segment, size_t offset)
+{
+	return segment->items + (segment->start + offset) * tiered->dataSize;
+}
+
+/*
+ * The spill file is created next to path under a fresh name, so an existing
+ * file is never touched, and unlinked as soon as it is open, so it never
+ * outlives the list, even when the process does not get to destroy it.
+ */
+static int CreateSpillFile(const char* path, const ListAllocator* allocator)
+{
+	size_t pathLength = strlen(path);
+	size_t templateSize = pathLength + sizeof(".XXXXXX");
+	char* template = allocator->alloc(allocator->ctx, templateSize);
+
+	if (template == NULL)
+	{
+		return -1;
+	}
+
+	memcpy(template, path, pathLength);
+	memcpy(template + pathLength, ".XXXXXX", sizeof(".XXXXXX"));
+
+	int file = mkstemp(template);
+
+	if (file >= 0)
+	{
+		unlink(template);
+	}
+
+	allocator->free(allocator->ctx, template, templateSize);
+
+	return file;
+}
+
+void* ListTieredCreate(size_t dataSize, const char* path, size_t memoryBudget, const ListAllocator* allocator)
+{
+	ListTiered* tiered = allocator->alloc(allocator->ctx, sizeof(ListTiered));
+
+	if (tiered == NULL)
+	{
+		return NULL;
+	}
+
+	tiered->file = CreateSpillFile(path, allocator);
+
+	if (tiered->file < 0)
+	{
+		allocator->free(allocator->ctx, tiered, sizeof(ListTiered));
+
+		return NULL;
+	}
+
+	tiered->segments = NULL;
+	tiered->segmentCount = 0;
+	tiered->segmentCapacity = 0;
+	tiered->segmentItems = dataSize < TIER_SEGMENT_BYTES ? TIER_SEGMENT_BYTES / dataSize : 1;
+	tiered->count = 0;
+	tiered->newest = NULL;
+	tiered->oldest = NULL;
+	tiered->residentCount = 0;
+	tiered->residentLimit = memoryBudget / (tiered->segmentItems * dataSize);
+	tiered->freeOffsets = NULL;
+	tiered->freeOffsetCount = 0;
+	tiered->freeOffsetCapacity = 0;
+	tiered->fileSize = 0;
+	tiered->cursorPosition = 0;
+	tiered->cursorIndex = 0;
+	tiered->dataSize = dataSize;
+	tiered->allocator = *allocator;
+
+	if (tiered->residentLimit < TIER_MINIMUM_RESIDENT_SEGMENTS)
+	{
+		tiered->residentLimit = TIER_MINIMUM_RESIDENT_SEGMENTS;
+	}
+
+	return tiered;
+}
+
+static void UnlinkResident(ListTiered* tiered, ListTierSegment* segment)
+{
+	if (segment->newer != NULL)
+	{
+		segment->newer->older = segment->older;
+	}
+	else
+	{
+		tiered->newest = segment->older;
+	}
+
+	if (segment->older != NULL)
+	{
+		segment->older->newer = segment->newer;
+	}
+	else
+	{
+		tiered->oldest = segment->newer;
+	}
+
+	segment->newer = NULL;
+	segment->older = NULL;
+}
+
+static void LinkResident(ListTiered* tiered, ListTierSegment* segment)
+{
+	segment->older = tiered->newest;
+	segment->newer = NULL;
+
+	if (tiered->newest != NULL)
+	{
+		tiered->newest->newer = segment;
+	}
+	else
+	{
+		tiered->oldest = segment;
+	}
+
+	tiered->newest = segment;
+}
+
+static void ReserveFileOffset(ListTiered* tiered, ListTierSegment* segment)
+{
+	if (segment->fileOffset != TIER_NOT_SPILLED)
+	{
+		return;
+	}
+
+	if (tiered->freeOffsetCount > 0)
+	{
+		segment->fileOffset = tiered->freeOffsets[--tiered->freeOffsetCount];
+
+		return;
+	}
+
+	segment->fileOffset = tiered->fileSize;
+	tiered->fileSize += (off_t)GetSegmentBytes(tiered);
+}
+
+static void ReleaseFileOffset(ListTiered* tiered, ListTierSegment* segment)
+{
+	if (segment->fileOffset == TIER_NOT_SPILLED)
+	{
+		return;
+	}
+
+	if (tiered->freeOffsetCount == tiered->freeOffsetCapacity)
+	{
+		size_t freeOffsetCapacity = tiered->freeOffsetCapacity == 0 ? 8 : tiered->freeOffsetCapacity * 2;
+		off_t* freeOffsets = tiered->allocator.alloc(tiered->allocator.ctx, freeOffsetCapacity * sizeof(off_t));
+
+		/* The slot is simply never reused when the free list cannot grow. */
+		if (freeOffsets == NULL)
+		{
+			return;
+		}
+
+		if (tiered->freeOffsets != NULL)
+		{
+			memcpy(freeOffsets, tiered->freeOffsets, tiered->freeOffsetCount * sizeof(off_t));
+			tiered->allocator.free(tiered->allocator.ctx, tiered->freeOffsets, tiered->freeOffsetCapacity * sizeof(off_t));
+		}
+
+		tiered->freeOffsets = freeOffsets;
+		tiered->freeOffsetCapacity = freeOffsetCapacity;
+	}
+
+	tiered->freeOffsets[tiered->freeOffsetCount++] = segment->fileOffset;
+}
+
+static int TransferSegment(ListTiered* tiered, ListTierSegment* segment, int write)
+{
+	size_t transferred = 0;
+	size_t size = GetSegmentBytes(tiered);
+
+	while (transferred < size)
+	{
+		ssize_t result = write
+			? pwrite(tiered->file, segment->items + transferred, size - transferred, segment->fileOffset + (off_t)transferred)
+			: pread(tiered->file, segment->items + transferred, size - transferred, segment->fileOffset + (off_t)transferred);
+
+		if (result < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (result <= 0)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		transferred += (size_t)result;
+	}
+
+	return 0;
+}
+
+static int EvictSegment(ListTiered* tiered, ListTierSegment* segment)
+{
+	if (segment->dirty || segment->fileOffset == TIER_NOT_SPILLED)
+	{
+		ReserveFileOffset(tiered, segment);
+
+		if (TransferSegment(tiered, segment, 1) != 0)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+	}
+
+	UnlinkResident(tiered, segment);
+	tiered->allocator.free(tiered->allocator.ctx, segment->items, GetSegmentBytes(tiered));
+	segment->items = NULL;
+	segment->dirty = 0;
+	tiered->residentCount--;
+
+	return 0;
+}
+
+static int MakeRoom(ListTiered* tiered)
+{
+	while (tiered->residentCount >= tiered->residentLimit)
+	{
+		if (EvictSegment(tiered, tiered->oldest) != 0)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Makes the segment resident and the newest one. The segment used just
+ * before is never the oldest at that point, so an item pointer handed out by
+ * one call stays valid through the next.
+ */
+static int TouchSegment(ListTiered* tiered, ListTierSegment* segment)
+{
+	if (segment->items != NULL)
+	{
+		UnlinkResident(tiered, segment);
+		LinkResident(tiered, segment);
+
+		return 0;
+	}
+
+	if (MakeRoom(tiered) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	segment->items = tiered->allocator.alloc(tiered->allocator.ctx, GetSegmentBytes(tiered));
+
+	if (segment->items == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	if (TransferSegment(tiered, segment, 0) != 0)
+	{
+		tiered->allocator.free(tiered->allocator.ctx, segment->items, GetSegmentBytes(tiered));
+		segment->items = NULL;
+
+		return ERROR_ELEMENT_NULL;
+	}
+
+	LinkResident(tiered, segment);
+	tiered->residentCount++;
+
+	return 0;
+}
+
+static int ReserveSegments(ListTiered* tiered)
+{
+	if (tiered->segmentCount < tiered->segmentCapacity)
+	{
+		return 0;
+	}
+
+	size_t segmentCapacity = tiered->segmentCapacity == 0 ? 8 : tiered->segmentCapacity * 2;
+	ListTierSegment** segments = tiered->allocator.alloc(tiered->allocator.ctx, segmentCapacity * sizeof(ListTierSegment*));
+
+	if (segments == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	if (tiered->segments != NULL)
+	{
+		memcpy(segments, tiered->segments, tiered->segmentCount * sizeof(ListTierSegment*));
+		tiered->allocator.free(tiered->allocator.ctx, tiered->segments, tiered->segmentCapacity * sizeof(ListTierSegment*));
+	}
+
+	tiered->segments = segments;
+	tiered->segmentCapacity = segmentCapacity;
+
+	return 0;
+}
+
+static ListTierSegment* CreateSegment(ListTiered* tiered, size_t position, size_t start)
+{
+	if (ReserveSegments(tiered) != 0 || MakeRoom(tiered) != 0)
+	{
+		return NULL;
+	}
+
+	ListTierSegment* segment = tiered->allocator.alloc(tiered->allocator.ctx, sizeof(ListTierSegment));
+
+	if (segment == NULL)
+	{
+		return NULL;
+	}
+
+	segment->items = tiered->allocator.alloc(tiered->allocator.ctx, GetSegmentBytes(tiered));
+
+	if (segment->items == NULL)
+	{
+		tiered->allocator.free(tiered->allocator.ctx, segment, sizeof(ListTierSegment));
+
+		return NULL;
+	}
+
+	segment->start = start;
+	segment->count = 0;
+	segment->fileOffset = TIER_NOT_SPILLED;
+	segment->dirty = 1;
+
+	LinkResident(tiered, segment);
+	tiered->residentCount++;
+
+	memmove(&tiered->segments[position + 1], &tiered->segments[position],
+		(tiered->segmentCount - position) * sizeof(ListTierSegment*));
+	tiered->segments[position] = segment;
+	tiered->segmentCount++;
+	tiered->cursorPosition = 0;
+	tiered->cursorIndex = 0;
+
+	return segment;
+}
+
+static void DestroySegment(ListTiered* tiered, ListTierSegment* segment)
+{
+	if (segment->items != NULL)
+	{
+		UnlinkResident(tiered, segment);
+		tiered->allocator.free(tiered->allocator.ctx, segment->items, GetSegmentBytes(tiered));
+		tiered->residentCount--;
+	}
+
+	ReleaseFileOffset(tiered, segment);
+	tiered->allocator.free(tiered->allocator.ctx, segment, sizeof(ListTierSegment));
+}
+
+static void RemoveSegment(ListTiered* tiered, size_t position)
+{
+	DestroySegment(tiered, tiered->segments[position]);
+
+	memmove(&tiered->segments[position], &tiered->segments[position + 1],
+		(tiered->segmentCount - position - 1) * sizeof(ListTierSegment*));
+	tiered->segmentCount--;
+	tiered->cursorPosition = 0;
+	tiered->cursorIndex = 0;
+}
+
+/*
+ * The last segment is checked first since queues keep coming back to it;
+ * otherwise the walk over segment counts starts at the segment found last
+ * when that one comes before the index.
+ */
+static size_t FindSegment(ListTiered* tiered, size_t index, size_t* offset)
+{
+	size_t lastPosition = tiered->segmentCount - 1;
+	size_t lastIndex = tiered->count - tiered->segments[lastPosition]->count;
+
+	if (index >= lastIndex)
+	{
+		*offset = index - lastIndex;
+
+		return lastPosition;
+	}
+
+	size_t position = 0;
+	size_t firstIndex = 0;
+
+	if (tiered->cursorIndex <= index)
+	{
+		position = tiered->cursorPosition;
+		firstIndex = tiered->cursorIndex;
+	}
+
+	while (index >= firstIndex + tiered->segments[position]->count)
+	{
+		firstIndex += tiered->segments[position]->count;
+		position++;
+	}
+
+	tiered->cursorPosition = position;
+	tiered->cursorIndex = firstIndex;
+	*offset = index - firstIndex;
+
+	return position;
+}
+
+static int ClearTiered(void* storage)
+{
+	ListTiered* tiered = storage;
+
+	for (size_t i = 0; i < tiered->segmentCount; i++)
+	{
+		DestroySegment(tiered, tiered->segments[i]);
+	}
+
+	tiered->segmentCount = 0;
+	tiered->count = 0;
+	tiered->freeOffsetCount = 0;
+	tiered->fileSize = 0;
+	tiered->cursorPosition = 0;
+	tiered->cursorIndex = 0;
+
+	if (ftruncate(tiered->file, 0) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	return 0;
+}
+
+static void DestroyTiered(void* storage)
+{
+	ListTiered* tiered = storage;
+
+	ClearTiered(tiered);
+
+	if (tiered->segments != NULL)
+	{
+		tiered->allocator.free(tiered->allocator.ctx, tiered->segments, tiered->segmentCapacity * sizeof(ListTierSegment*));
+	}
+	if (tiered->freeOffsets != NULL)
+	{
+		tiered->allocator.free(tiered->allocator.ctx, tiered->freeOffsets, tiered->freeOffsetCapacity * sizeof(off_t));
+	}
+
+	close(tiered->file);
+	tiered->allocator.free(tiered->allocator.ctx, tiered, sizeof(ListTiered));
+}
+
+static size_t CountTiered(void* storage)
+{
+	return ((ListTiered*)storage)->count;
+}
+
+static int PushTieredFront(void* storage, const void* item)
+{
+	ListTiered* tiered = storage;
+	ListTierSegment* segment = tiered->segmentCount > 0 ? tiered->segments[0] : NULL;
+
+	if (segment == NULL || segment->start == 0)
+	{
+		segment = CreateSegment(tiered, 0, tiered->segmentItems);
+	}
+	else if (TouchSegment(tiered, segment) != 0)
+	{
+		segment = NULL;
+	}
+
+	if (segment == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	segment->start--;
+	segment->count++;
+	segment->dirty = 1;
+	memcpy(GetSlot(tiered, segment, 0), item, tiered->dataSize);
+	tiered->count++;
+	tiered->cursorPosition = 0;
+	tiered->cursorIndex = 0;
+
+	return 0;
+}
+
+static int PushTieredBack(void* storage, const void* item)
+{
+	ListTiered* tiered = storage;
+	ListTierSegment* segment = tiered->segmentCount > 0 ? tiered->segments[tiered->segmentCount - 1] : NULL;
+
+	if (segment == NULL || segment->start + segment->count == tiered->segmentItems)
+	{
+		segment = CreateSegment(tiered, tiered->segmentCount, 0);
+	}
+	else if (TouchSegment(tiered, segment) != 0)
+	{
+		segment = NULL;
+	}
+
+	if (segment == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	memcpy(GetSlot(tiered, segment, segment->count), item, tiered->dataSize);
+	segment->count++;
+	segment->dirty = 1;
+	tiered->count++;
+
+	return 0;
+}
+
+/*
+ * A full segment is split in half first, so an insertion in the middle moves
+ * at most one segment's worth of items.
+ */
+static int PushTieredAt(void* storage, size_t index, const void* item)
+{
+	ListTiered* tiered = storage;
+
+	if (index == 0)
+	{
+		return PushTieredFront(tiered, item);
+	}
+	if (index == tiered->count)
+	{
+		return PushTieredBack(tiered, item);
+	}
+
+	size_t offset = 0;
+	size_t position = FindSegment(tiered, index, &offset);
+	ListTierSegment* segment = tiered->segments[position];
+
+	if (TouchSegment(tiered, segment) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	if (segment->count == tiered->segmentItems)
+	{
+		size_t half = segment->count / 2;
+		ListTierSegment* splitSegment = CreateSegment(tiered, position + 1, 0);
+
+		if (splitSegment == NULL)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		memcpy(splitSegment->items, GetSlot(tiered, segment, half), (segment->count - half) * tiered->dataSize);
+		splitSegment->count = segment->count - half;
+		segment->count = half;
+		segment->dirty = 1;
+
+		if (offset >= half)
+		{
+			segment = splitSegment;
+			offset -= half;
+		}
+	}
+
+	if (segment->start + segment->count < tiered->segmentItems)
+	{
+		memmove(GetSlot(tiered, segment, offset + 1), GetSlot(tiered, segment, offset),
+			(segment->count - offset) * tiered->dataSize);
+	}
+	else
+	{
+		segment->start--;
+		memmove(GetSlot(tiered, segment, 0), GetSlot(tiered, segment, 1), offset * tiered->dataSize);
+	}
+
+	memcpy(GetSlot(tiered, segment, offset), item, tiered->dataSize);
+	segment->count++;
+	segment->dirty = 1;
+	tiered->count++;
+	tiered->cursorPosition = 0;
+	tiered->cursorIndex = 0;
+
+	return 0;
+}
+
+static int PopTieredFront(void* storage)
+{
+	ListTiered* tiered = storage;
+	ListTierSegment* segment = tiered->segments[0];
+
+	segment->start++;
+	segment->count--;
+	tiered->count--;
+	tiered->cursorPosition = 0;
+	tiered->cursorIndex = 0;
+
+	if (segment->count == 0)
+	{
+		RemoveSegment(tiered, 0);
+	}
+
+	return 0;
+}
+
+static int PopTieredBack(void* storage)
+{
+	ListTiered* tiered = storage;
+	ListTierSegment* segment = tiered->segments[tiered->segmentCount - 1];
+
+	segment->count--;
+	tiered->count--;
+	tiered->cursorPosition = 0;
+	tiered->cursorIndex = 0;
+
+	if (segment->count == 0)
+	{
+		RemoveSegment(tiered, tiered->segmentCount - 1);
+	}
+
+	return 0;
+}
+
+static int PopTieredAt(void* storage, size_t index)
+{
+	ListTiered* tiered = storage;
+
+	if (index == 0)
+	{
+		return PopTieredFront(tiered);
+	}
+	if (index == tiered->count - 1)
+	{
+		return PopTieredBack(tiered);
+	}
+
+	size_t offset = 0;
+	size_t position = FindSegment(tiered, index, &offset);
+	ListTierSegment* segment = tiered->segments[position];
+
+	if (offset == 0)
+	{
+		segment->start++;
+	}
+	else
+	{
+		if (TouchSegment(tiered, segment) != 0)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+
+		memmove(GetSlot(tiered, segment, offset), GetSlot(tiered, segment, offset + 1),
+			(segment->count - offset - 1) * tiered->dataSize);
+		segment->dirty = 1;
+	}
+
+	segment->count--;
+	tiered->count--;
+	tiered->cursorPosition = 0;
+	tiered->cursorIndex = 0;
+
+	if (segment->count == 0)
+	{
+		RemoveSegment(tiered, position);
+	}
+
+	return 0;
+}
+
+static int ReplaceTieredItem(void* storage, size_t index, const void* item)
+{
+	ListTiered* tiered = storage;
+	size_t offset = 0;
+	ListTierSegment* segment = tiered->segments[FindSegment(tiered, index, &offset)];
+
+	if (TouchSegment(tiered, segment) != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	memcpy(GetSlot(tiered, segment, offset), item, tiered->dataSize);
+	segment->dirty = 1;
+
+	return 0;
+}
+
+static void* GetTieredItem(void* storage, size_t index)
+{
+	ListTiered* tiered = storage;
+	size_t offset = 0;
+	ListTierSegment* segment = tiered->segments[FindSegment(tiered, index, &offset)];
+
+	if (TouchSegment(tiered, segment) != 0)
+	{
+		return NULL;
+	}
+
+	return GetSlot(tiered, segment, offset);
+}
+
+const ListStorage ListTieredStorage = {
+	DestroyTiered,
+	CountTiered,
+	PushTieredFront,
+	PushTieredBack,
+	PushTieredAt,
+	PopTieredFront,
+	PopTieredBack,
+	PopTieredAt,
+	ReplaceTieredItem,
+	ClearTiered,
+	GetTieredItem,
+	NULL,
+	NULL,
+	NULL,
+	1,
+};
@@ -0,0 +1,85 @@
+#include "ListTrace.h"
+#include <string.h>
+
+#ifdef LINKEDLIST_TRACING
+
+#include <time.h>
+
+#ifdef LINKEDLIST_USDT
+#include <sys/sdt.h>
+#endif
+
+#define LIST_TRACE_NAME(operation) #operation,
+
+static const char* const operationNames[LIST_TRACE_OPERATION_COUNT] = { LIST_TRACED_OPERATIONS(LIST_TRACE_NAME) };
+
+static uint64_t histograms[LIST_TRACE_OPERATION_COUNT][LIST_LATENCY_BUCKETS];
+
+_Thread_local size_t listTraceSteps = 0;
+
+static uint64_t GetNanoseconds(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+void ListTraceEnter(ListTraceScope* scope, LinkedList* list)
+{
+	scope->length = list != NULL ? ListCount(list) : 0;
+	scope->steps = listTraceSteps;
+
+#ifdef LINKEDLIST_USDT
+	STAP_PROBE2(linkedlist, entry, operationNames[scope->operation], scope->length);
+#endif
+
+	scope->start = GetNanoseconds();
+}
+
+void ListTraceExit(ListTraceScope* scope)
+{
+	uint64_t latency = GetNanoseconds() - scope->start;
+	size_t depth = listTraceSteps - scope->steps;
+	size_t bucket = latency == 0 ? 0 : 63 - (size_t)__builtin_clzll(latency);
+
+	__atomic_fetch_add(&histograms[scope->operation][bucket], 1, __ATOMIC_RELAXED);
+
+#ifdef LINKEDLIST_USDT
+	STAP_PROBE4(linkedlist, exit, operationNames[scope->operation], scope->length, depth, latency);
+#else
+	(void)depth;
+#endif
+}
+
+#endif
+
+int ListGetLatencyHistogram(const char* operation, uint64_t* buckets)
+{
+	if (operation == NULL || buckets == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+#ifdef LINKEDLIST_TRACING
+	for (size_t i = 0; i < LIST_TRACE_OPERATION_COUNT; i++)
+	{
+		if (strcmp(operationNames[i], operation) != 0)
+		{
+			continue;
+		}
+
+		for (size_t bucket = 0; bucket < LIST_LATENCY_BUCKETS; bucket++)
+		{
+			buckets[bucket] = __atomic_load_n(&histograms[i][bucket], __ATOMIC_RELAXED);
+		}
+
+		return 0;
+	}
+
+	return ERROR_INVALID_ITEM;
+#else
+	return ERROR_INVALID_OPERATION;
+#endif
+}
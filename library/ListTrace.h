@@ -0,0 +1,97 @@
+#ifndef LISTTRACE_H
+#define LISTTRACE_H
+
+#include "LinkedList/LinkedList.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define LIST_TRACED_OPERATIONS(X) \
+	X(ListInitialise) \
+	X(ListInitialiseWithAllocator) \
+	X(ListInitialiseSorted) \
+	X(ListInitialiseConcurrent) \
+	X(ListInitialiseSelfOrganising) \
+	X(ListInitialiseDeque) \
+	X(ListInitialiseRing) \
+	X(ListInitialiseCompact) \
+	X(ListInitialiseTiered) \
+	X(ListInitialiseCompressed) \
+	X(ListDestroy) \
+	X(ListDestroyAsync) \
+	X(ListClone) \
+	X(ListPushFront) \
+	X(ListPushBack) \
+	X(ListPushAt) \
+	X(ListPopFront) \
+	X(ListPopBack) \
+	X(ListPopAt) \
+	X(ListReplace) \
+	X(ListClear) \
+	X(ListClearIncremental) \
+	X(ListGetItem) \
+	X(ListGetItems) \
+	X(ListGetIndex) \
+	X(ListPushBackMany) \
+	X(ListPopFrontMany) \
+	X(ListGetRange) \
+	X(ListPopRange) \
+	X(ListReplaceRange) \
+	X(ListRotate) \
+	X(ListRemoveIf) \
+	X(ListRetainIf) \
+	X(ListSortByKey) \
+	X(ListInsertSorted) \
+	X(ListFindSorted) \
+	X(ListLowerBound) \
+	X(ListMergeSorted) \
+	X(ListConcatenate) \
+	X(ListIntersectSorted) \
+	X(ListDifferenceSorted) \
+	X(ListUnionSorted) \
+	X(ListCompact) \
+	X(ListFragmentation) \
+	X(ListReadBegin) \
+	X(ListReadEnd)
+
+#define LIST_TRACE_ENUM(operation) LIST_TRACE_##operation,
+
+typedef enum ListTraceOperation
+{
+	LIST_TRACED_OPERATIONS(LIST_TRACE_ENUM)
+	LIST_TRACE_OPERATION_COUNT
+} ListTraceOperation;
+
+#ifdef LINKEDLIST_TRACING
+
+typedef struct ListTraceScope
+{
+	ListTraceOperation operation;
+	size_t length;
+	size_t steps;
+	uint64_t start;
+} ListTraceScope;
+
+extern _Thread_local size_t listTraceSteps;
+
+void ListTraceEnter(ListTraceScope* scope, LinkedList* list);
+void ListTraceExit(ListTraceScope* scope);
+
+/*
+ * Opens a scope that fires the entry probe now and the exit probe, with the
+ * number of elements walked in between and the latency, whenever the
+ * enclosing function returns.
+ */
+#define TRACE_OPERATION(operation, list) \
+	ListTraceScope traceScope __attribute__((cleanup(ListTraceExit))) = { LIST_TRACE_##operation, 0, 0, 0 }; \
+	ListTraceEnter(&traceScope, (list))
+
+#define TRACE_STEPS(count) (listTraceSteps += (count))
+
+#else
+
+#define TRACE_OPERATION(operation, list)
+#define TRACE_STEPS(count)
+
+#endif
+
+#endif
@@ -0,0 +1,395 @@
+#include "LinkedList/LockFreeList.h"
+#include "Epoch.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOCK_FREE_CACHE_LINE 64
+#define LOCK_FREE_MARK ((uintptr_t)1)
+
+/*
+ * The lowest bit of next marks a node as removed. Once marked, next never
+ * changes again, so a node can only be unlinked by swapping the unmarked
+ * pointer to it in its predecessor, and no node is ever inserted behind a
+ * removed one.
+ */
+typedef struct LockFreeNode
+{
+	uintptr_t next;
+	struct LockFreeNode* retiredNext;
+} LockFreeNode;
+
+/*
+ * Harris's list with Michael's search: removal marks a node before it is
+ * unlinked, and every search unlinks the marked nodes it passes. Whoever
+ * unlinks a node pushes it on the retired stack, whose nodes are handed to
+ * the epoch limbo by one thread at a time outside its read section. The
+ * head and the retired stack are written by every thread and get a cache
+ * line each.
+ */
+typedef struct LockFreeList
+{
+	size_t dataSize;
+	int (*compar)(const void*, const void*);
+
+	uintptr_t head __attribute__((aligned(LOCK_FREE_CACHE_LINE)));
+
+	LockFreeNode* retired __attribute__((aligned(LOCK_FREE_CACHE_LINE)));
+	int reclaiming;
+	EpochLimbo limbo;
+} LockFreeList;
+
+static size_t AlignSize(size_t size)
+{
+	size_t alignment = sizeof(max_align_t);
+
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+static void* GetData(LockFreeNode* node)
+{
+	return (unsigned char*)node + AlignSize(sizeof(LockFreeNode));
+}
+
+static LockFreeNode* GetNode(uintptr_t link)
+{
+	return (LockFreeNode*)(link & ~LOCK_FREE_MARK);
+}
+
+static int IsMarked(uintptr_t link)
+{
+	return (link & LOCK_FREE_MARK) != 0;
+}
+
+static uintptr_t GetLink(uintptr_t* link)
+{
+	return __atomic_load_n(link, __ATOMIC_ACQUIRE);
+}
+
+static int SwapLink(uintptr_t* link, uintptr_t expected, uintptr_t desired)
+{
+	return __atomic_compare_exchange_n(link, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static void FreeNode(void* ctx, void* node)
+{
+	(void)ctx;
+
+	free(node);
+}
+
+LockFreeList* LockFreeListInitialise(size_t dataSize, int (*compar)(const void*, const void*))
+{
+	if (dataSize == 0 || compar == NULL)
+	{
+		return NULL;
+	}
+
+	LockFreeList* list = aligned_alloc(LOCK_FREE_CACHE_LINE, sizeof(LockFreeList));
+
+	if (list == NULL)
+	{
+		return NULL;
+	}
+
+	list->head = 0;
+	list->retired = NULL;
+	list->reclaiming = 0;
+	list->dataSize = dataSize;
+	list->compar = compar;
+
+	EpochLimboInitialise(&list->limbo);
+
+	return list;
+}
+
+int LockFreeListDestroy(LockFreeList** list)
+{
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	if (*list == NULL)
+	{
+		return 0;
+	}
+
+	LockFreeNode* node = GetNode((*list)->head);
+
+	while (node != NULL)
+	{
+		LockFreeNode* next = GetNode(node->next);
+
+		free(node);
+		node = next;
+	}
+
+	node = (*list)->retired;
+
+	while (node != NULL)
+	{
+		LockFreeNode* next = node->retiredNext;
+
+		free(node);
+		node = next;
+	}
+
+	EpochLimboDestroy(&(*list)->limbo);
+
+	free(*list);
+	*list = NULL;
+
+	return 0;
+}
+
+static void RetireNode(LockFreeList* list, LockFreeNode* node)
+{
+	node->retiredNext = __atomic_load_n(&list->retired, __ATOMIC_RELAXED);
+
+	while (!__atomic_compare_exchange_n(&list->retired, &node->retiredNext, node, 1, __ATOMIC_RELEASE,
+		__ATOMIC_RELAXED))
+	{
+	}
+}
+
+/*
+ * Must be called outside a read section, since handing nodes to the limbo may
+ * wait for the epoch to advance. A thread that finds another one reclaiming
+ * leaves its nodes to that thread or the next one.
+ */
+static void ReclaimNodes(LockFreeList* list)
+{
+	if (__atomic_load_n(&list->retired, __ATOMIC_RELAXED) == NULL)
+	{
+		return;
+	}
+
+	int expected = 0;
+
+	if (!__atomic_compare_exchange_n(&list->reclaiming, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+	{
+		return;
+	}
+
+	LockFreeNode* node = __atomic_exchange_n(&list->retired, NULL, __ATOMIC_ACQUIRE);
+
+	while (node != NULL)
+	{
+		LockFreeNode* next = node->retiredNext;
+
+		EpochRetire(&list->limbo, node, FreeNode, NULL);
+		node = next;
+	}
+
+	EpochReclaim(&list->limbo);
+
+	__atomic_store_n(&list->reclaiming, 0, __ATOMIC_RELEASE);
+}
+
+/*
+ * Finds the first node whose item is not less than the item and the link
+ * that points to it, unlinking every marked node on the way. Returns 1 when
+ * that node holds an equal item.
+ */
+static int FindNode(LockFreeList* list, const void* item, uintptr_t** previousLink, LockFreeNode** current)
+{
+retry:
+	*previousLink = &list->head;
+	*current = GetNode(GetLink(*previousLink));
+
+	while (*current != NULL)
+	{
+		uintptr_t next = GetLink(&(*current)->next);
+
+		if (IsMarked(next))
+		{
+			if (!SwapLink(*previousLink, (uintptr_t)*current, (uintptr_t)GetNode(next)))
+			{
+				goto retry;
+			}
+
+			RetireNode(list, *current);
+			*current = GetNode(next);
+
+			continue;
+		}
+
+		int comparison = list->compar(GetData(*current), item);
+
+		if (comparison >= 0)
+		{
+			return comparison == 0;
+		}
+
+		*previousLink = &(*current)->next;
+		*current = GetNode(next);
+	}
+
+	return 0;
+}
+
+size_t LockFreeListCount(LockFreeList* list)
+{
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (EpochReadBegin() != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	size_t count = 0;
+
+	for (uintptr_t link = GetLink(&list->head); GetNode(link) != NULL; link = GetLink(&GetNode(link)->next))
+	{
+		count += !IsMarked(GetLink(&GetNode(link)->next));
+	}
+
+	EpochReadEnd();
+
+	return count;
+}
+
+int LockFreeListInsert(LockFreeList* list, const void* item)
+{
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	LockFreeNode* node = malloc(AlignSize(sizeof(LockFreeNode)) + list->dataSize);
+
+	if (node == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	memcpy(GetData(node), item, list->dataSize);
+	node->retiredNext = NULL;
+
+	if (EpochReadBegin() != 0)
+	{
+		free(node);
+
+		return ERROR_ELEMENT_NULL;
+	}
+
+	int result = 0;
+	uintptr_t* previousLink = NULL;
+	LockFreeNode* current = NULL;
+
+	while (1)
+	{
+		if (FindNode(list, item, &previousLink, &current))
+		{
+			free(node);
+			result = ERROR_INVALID_ITEM;
+
+			break;
+		}
+
+		__atomic_store_n(&node->next, (uintptr_t)current, __ATOMIC_RELAXED);
+
+		if (SwapLink(previousLink, (uintptr_t)current, (uintptr_t)node))
+		{
+			break;
+		}
+	}
+
+	EpochReadEnd();
+	ReclaimNodes(list);
+
+	return result;
+}
+
+int LockFreeListRemove(LockFreeList* list, const void* item)
+{
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+	if (EpochReadBegin() != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	int result = 0;
+	uintptr_t* previousLink = NULL;
+	LockFreeNode* current = NULL;
+
+	while (1)
+	{
+		if (!FindNode(list, item, &previousLink, &current))
+		{
+			result = ERROR_INVALID_ITEM;
+
+			break;
+		}
+
+		uintptr_t next = GetLink(&current->next);
+
+		if (IsMarked(next) || !SwapLink(&current->next, next, next | LOCK_FREE_MARK))
+		{
+			continue;
+		}
+
+		if (SwapLink(previousLink, (uintptr_t)current, next))
+		{
+			RetireNode(list, current);
+		}
+		else
+		{
+			FindNode(list, item, &previousLink, &current);
+		}
+
+		break;
+	}
+
+	EpochReadEnd();
+	ReclaimNodes(list);
+
+	return result;
+}
+
+/*
+ * Searching never writes, so it finishes in a number of steps bounded by the
+ * nodes ahead of the item even while other threads keep changing the list.
+ */
+int LockFreeListContains(LockFreeList* list, const void* item)
+{
+	if (list == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+	if (EpochReadBegin() != 0)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	LockFreeNode* current = GetNode(GetLink(&list->head));
+
+	while (current != NULL && list->compar(GetData(current), item) < 0)
+	{
+		current = GetNode(GetLink(&current->next));
+	}
+
+	int contains = current != NULL && list->compar(GetData(current), item) == 0 && !IsMarked(GetLink(&current->next));
+
+	EpochReadEnd();
+
+	return contains;
+}
@@ -0,0 +1,309 @@
+#include "LinkedList/LruCache.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct LruEntry
+{
+	struct LruEntry* previous;
+	struct LruEntry* next;
+	uint64_t hash;
+} LruEntry;
+
+typedef struct LruCache
+{
+	LruEntry* front;
+	LruEntry* back;
+	unsigned char* entries;
+	size_t entrySize;
+	LruEntry** slots;
+	size_t slotMask;
+	size_t keySize;
+	size_t valueSize;
+	size_t capacity;
+	size_t count;
+	void (*evict)(const void* key, void* value, void* ctx);
+	void* ctx;
+} LruCache;
+
+static size_t AlignSize(size_t size)
+{
+	size_t alignment = sizeof(max_align_t);
+
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+static void* GetKey(LruEntry* entry)
+{
+	return (unsigned char*)entry + AlignSize(sizeof(LruEntry));
+}
+
+static void* GetValue(LruCache* cache, LruEntry* entry)
+{
+	return (unsigned char*)GetKey(entry) + AlignSize(cache->keySize);
+}
+
+static uint64_t HashKey(const void* key, size_t keySize)
+{
+	const unsigned char* bytes = key;
+	uint64_t hash = 14695981039346656037ULL;
+
+	for (size_t i = 0; i < keySize; i++)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash ^ (hash >> 32);
+}
+
+LruCache* LruInitialise(size_t capacity, size_t keySize, size_t valueSize,
+	void (*evict)(const void* key, void* value, void* ctx), void* ctx)
+{
+	if (capacity == 0 || keySize == 0 || valueSize == 0)
+	{
+		return NULL;
+	}
+
+	LruCache* cache = malloc(sizeof(LruCache));
+
+	if (cache == NULL)
+	{
+		return NULL;
+	}
+
+	size_t slotCount = 1;
+
+	while (slotCount < capacity * 2)
+	{
+		slotCount *= 2;
+	}
+
+	cache->entrySize = AlignSize(sizeof(LruEntry)) + AlignSize(keySize) + AlignSize(valueSize);
+	cache->entries = malloc(capacity * cache->entrySize);
+	cache->slots = calloc(slotCount, sizeof(LruEntry*));
+
+	if (cache->entries == NULL || cache->slots == NULL)
+	{
+		free(cache->entries);
+		free(cache->slots);
+		free(cache);
+
+		return NULL;
+	}
+
+	cache->front = NULL;
+	cache->back = NULL;
+	cache->slotMask = slotCount - 1;
+	cache->keySize = keySize;
+	cache->valueSize = valueSize;
+	cache->capacity = capacity;
+	cache->count = 0;
+	cache->evict = evict;
+	cache->ctx = ctx;
+
+	return cache;
+}
+
+int LruDestroy(LruCache** cache)
+{
+	if (cache == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	if (*cache == NULL)
+	{
+		return 0;
+	}
+
+	free((*cache)->entries);
+	free((*cache)->slots);
+	free(*cache);
+	*cache = NULL;
+
+	return 0;
+}
+
+size_t LruCount(LruCache* cache)
+{
+	if (cache == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	return cache->count;
+}
+
+static size_t FindSlot(LruCache* cache, const void* key, uint64_t hash)
+{
+	size_t slot = hash & cache->slotMask;
+
+	while (cache->slots[slot] != NULL)
+	{
+		LruEntry* entry = cache->slots[slot];
+
+		if (entry->hash == hash && memcmp(GetKey(entry), key, cache->keySize) == 0)
+		{
+			break;
+		}
+
+		slot = (slot + 1) & cache->slotMask;
+	}
+
+	return slot;
+}
+
+static void RemoveSlot(LruCache* cache, size_t slot)
+{
+	size_t nextSlot = slot;
+
+	while (1)
+	{
+		nextSlot = (nextSlot + 1) & cache->slotMask;
+
+		LruEntry* entry = cache->slots[nextSlot];
+
+		if (entry == NULL)
+		{
+			break;
+		}
+
+		size_t homeSlot = entry->hash & cache->slotMask;
+
+		if (((nextSlot - homeSlot) & cache->slotMask) >= ((nextSlot - slot) & cache->slotMask))
+		{
+			cache->slots[slot] = entry;
+			slot = nextSlot;
+		}
+	}
+
+	cache->slots[slot] = NULL;
+}
+
+static void UnlinkEntry(LruCache* cache, LruEntry* entry)
+{
+	if (entry->previous != NULL)
+	{
+		entry->previous->next = entry->next;
+	}
+	else
+	{
+		cache->front = entry->next;
+	}
+
+	if (entry->next != NULL)
+	{
+		entry->next->previous = entry->previous;
+	}
+	else
+	{
+		cache->back = entry->previous;
+	}
+}
+
+static void LinkEntryFront(LruCache* cache, LruEntry* entry)
+{
+	entry->previous = NULL;
+	entry->next = cache->front;
+
+	if (cache->front != NULL)
+	{
+		cache->front->previous = entry;
+	}
+	else
+	{
+		cache->back = entry;
+	}
+
+	cache->front = entry;
+}
+
+static LruEntry* EvictEntry(LruCache* cache)
+{
+	LruEntry* entry = cache->back;
+
+	if (cache->evict != NULL)
+	{
+		cache->evict(GetKey(entry), GetValue(cache, entry), cache->ctx);
+	}
+
+	RemoveSlot(cache, FindSlot(cache, GetKey(entry), entry->hash));
+	UnlinkEntry(cache, entry);
+
+	return entry;
+}
+
+int LruGet(LruCache* cache, const void* key, void** value)
+{
+	if (cache == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (key == NULL || value == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	LruEntry* entry = cache->slots[FindSlot(cache, key, HashKey(key, cache->keySize))];
+
+	if (entry == NULL)
+	{
+		return ERROR_INVALID_ITEM;
+	}
+
+	if (entry != cache->front)
+	{
+		UnlinkEntry(cache, entry);
+		LinkEntryFront(cache, entry);
+	}
+
+	*value = GetValue(cache, entry);
+
+	return 0;
+}
+
+int LruPut(LruCache* cache, const void* key, const void* value)
+{
+	if (cache == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (key == NULL || value == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	uint64_t hash = HashKey(key, cache->keySize);
+	size_t slot = FindSlot(cache, key, hash);
+	LruEntry* entry = cache->slots[slot];
+
+	if (entry != NULL)
+	{
+		memcpy(GetValue(cache, entry), value, cache->valueSize);
+		UnlinkEntry(cache, entry);
+		LinkEntryFront(cache, entry);
+
+		return 0;
+	}
+
+	if (cache->count == cache->capacity)
+	{
+		entry = EvictEntry(cache);
+		slot = FindSlot(cache, key, hash);
+	}
+	else
+	{
+		entry = (LruEntry*)(cache->entries + cache->count * cache->entrySize);
+		cache->count++;
+	}
+
+	entry->hash = hash;
+	memcpy(GetKey(entry), key, cache->keySize);
+	memcpy(GetValue(cache, entry), value, cache->valueSize);
+
+	cache->slots[slot] = entry;
+	LinkEntryFront(cache, entry);
+
+	return 0;
+}
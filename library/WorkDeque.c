@@ -0,0 +1,350 @@
+#include "LinkedList/WorkDeque.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WORK_DEQUE_CACHE_LINE 64
+#define WORK_DEQUE_INITIAL_CAPACITY 32
+#define WORK_DEQUE_BUFFER_WORDS 32
+
+/*
+ * Arrays replaced by a grow stay reachable through previous until the deque
+ * is destroyed, since a thief may still be copying a slot out of one. The
+ * retired arrays together are never larger than the current one.
+ */
+typedef struct WorkDequeArray
+{
+	struct WorkDequeArray* previous;
+	unsigned char* slots;
+	int64_t mask;
+} WorkDequeArray;
+
+/*
+ * Chase-Lev deque. The owner pushes and pops at bottom and only has to
+ * synchronise with thieves when a single item is left; thieves take items
+ * from top with a compare-and-swap.
+ */
+typedef struct WorkDeque
+{
+	int64_t top;
+	unsigned char topPadding[WORK_DEQUE_CACHE_LINE - sizeof(int64_t)];
+
+	int64_t bottom;
+	WorkDequeArray* array;
+	size_t dataSize;
+	size_t slotSize;
+} WorkDeque;
+
+static size_t AlignSize(size_t size)
+{
+	size_t alignment = sizeof(max_align_t);
+
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+static WorkDequeArray* CreateArray(size_t slotSize, int64_t capacity, WorkDequeArray* previous)
+{
+	WorkDequeArray* array = malloc(AlignSize(sizeof(WorkDequeArray)) + (size_t)capacity * slotSize);
+
+	if (array == NULL)
+	{
+		return NULL;
+	}
+
+	array->previous = previous;
+	array->slots = (unsigned char*)array + AlignSize(sizeof(WorkDequeArray));
+	array->mask = capacity - 1;
+
+	return array;
+}
+
+static void* GetSlot(WorkDeque* deque, WorkDequeArray* array, int64_t index)
+{
+	return array->slots + (size_t)(index & array->mask) * deque->slotSize;
+}
+
+/*
+ * A thief may read a slot while the owner overwrites it, in which case the
+ * thief's swap fails and the copy is discarded. Slots are therefore copied
+ * word by word with atomic loads and stores, so that overlap is not a race.
+ */
+static void StoreSlot(WorkDeque* deque, void* slot, const void* item)
+{
+	uint64_t* words = slot;
+
+	for (size_t offset = 0; offset < deque->dataSize; offset += sizeof(uint64_t))
+	{
+		uint64_t word = 0;
+		size_t size = deque->dataSize - offset < sizeof(uint64_t) ? deque->dataSize - offset : sizeof(uint64_t);
+
+		memcpy(&word, (const unsigned char*)item + offset, size);
+		__atomic_store_n(&words[offset / sizeof(uint64_t)], word, __ATOMIC_RELAXED);
+	}
+}
+
+static void LoadSlot(WorkDeque* deque, const void* slot, void* item)
+{
+	const uint64_t* words = slot;
+
+	for (size_t offset = 0; offset < deque->dataSize; offset += sizeof(uint64_t))
+	{
+		uint64_t word = __atomic_load_n(&words[offset / sizeof(uint64_t)], __ATOMIC_RELAXED);
+		size_t size = deque->dataSize - offset < sizeof(uint64_t) ? deque->dataSize - offset : sizeof(uint64_t);
+
+		memcpy((unsigned char*)item + offset, &word, size);
+	}
+}
+
+/*
+ * An item that another thread may take as well is copied to a buffer first,
+ * so the caller's item is only written once the item is claimed. Small items
+ * use the caller's stack buffer.
+ */
+static void* GetBuffer(WorkDeque* deque, uint64_t* stackBuffer)
+{
+	return deque->slotSize <= WORK_DEQUE_BUFFER_WORDS * sizeof(uint64_t) ? stackBuffer : malloc(deque->slotSize);
+}
+
+static void ReleaseBuffer(void* buffer, uint64_t* stackBuffer)
+{
+	if (buffer != stackBuffer)
+	{
+		free(buffer);
+	}
+}
+
+static WorkDequeArray* GrowArray(WorkDeque* deque, WorkDequeArray* array, int64_t top, int64_t bottom)
+{
+	WorkDequeArray* newArray = CreateArray(deque->slotSize, (array->mask + 1) * 2, array);
+
+	if (newArray == NULL)
+	{
+		return NULL;
+	}
+
+	for (int64_t i = top; i < bottom; i++)
+	{
+		memcpy(GetSlot(deque, newArray, i), GetSlot(deque, array, i), deque->slotSize);
+	}
+
+	__atomic_store_n(&deque->array, newArray, __ATOMIC_RELEASE);
+
+	return newArray;
+}
+
+WorkDeque* WorkDequeInitialise(size_t dataSize)
+{
+	if (dataSize == 0)
+	{
+		return NULL;
+	}
+
+	WorkDeque* deque = malloc(sizeof(WorkDeque));
+
+	if (deque == NULL)
+	{
+		return NULL;
+	}
+
+	deque->slotSize = (dataSize + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+	deque->array = CreateArray(deque->slotSize, WORK_DEQUE_INITIAL_CAPACITY, NULL);
+
+	if (deque->array == NULL)
+	{
+		free(deque);
+
+		return NULL;
+	}
+
+	deque->top = 0;
+	deque->bottom = 0;
+	deque->dataSize = dataSize;
+
+	return deque;
+}
+
+int WorkDequeDestroy(WorkDeque** deque)
+{
+	if (deque == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	if (*deque == NULL)
+	{
+		return 0;
+	}
+
+	WorkDequeArray* array = (*deque)->array;
+
+	while (array != NULL)
+	{
+		WorkDequeArray* previous = array->previous;
+
+		free(array);
+		array = previous;
+	}
+
+	free(*deque);
+	*deque = NULL;
+
+	return 0;
+}
+
+size_t WorkDequeCount(WorkDeque* deque)
+{
+	if (deque == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+
+	int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+	int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+
+	return bottom > top ? (size_t)(bottom - top) : 0;
+}
+
+int WorkDequePush(WorkDeque* deque, const void* item)
+{
+	if (deque == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+	int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+	WorkDequeArray* array = __atomic_load_n(&deque->array, __ATOMIC_RELAXED);
+
+	if (bottom - top > array->mask)
+	{
+		array = GrowArray(deque, array, top, bottom);
+
+		if (array == NULL)
+		{
+			return ERROR_ELEMENT_NULL;
+		}
+	}
+
+	StoreSlot(deque, GetSlot(deque, array, bottom), item);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+	return 0;
+}
+
+int WorkDequePop(WorkDeque* deque, void* item)
+{
+	if (deque == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) - 1;
+	WorkDequeArray* array = __atomic_load_n(&deque->array, __ATOMIC_RELAXED);
+
+	__atomic_store_n(&deque->bottom, bottom, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	int64_t top = __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+
+	if (top > bottom)
+	{
+		__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+		return ERROR_LIST_EMPTY;
+	}
+
+	if (top < bottom)
+	{
+		LoadSlot(deque, GetSlot(deque, array, bottom), item);
+
+		return 0;
+	}
+
+	uint64_t stackBuffer[WORK_DEQUE_BUFFER_WORDS];
+	void* buffer = GetBuffer(deque, stackBuffer);
+
+	if (buffer == NULL)
+	{
+		__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+		return ERROR_ELEMENT_NULL;
+	}
+
+	LoadSlot(deque, GetSlot(deque, array, bottom), buffer);
+
+	int result = __atomic_compare_exchange_n(&deque->top, &top, top + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)
+		? 0 : ERROR_LIST_EMPTY;
+
+	__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+	if (result == 0)
+	{
+		memcpy(item, buffer, deque->dataSize);
+	}
+
+	ReleaseBuffer(buffer, stackBuffer);
+
+	return result;
+}
+
+int WorkDequeSteal(WorkDeque* deque, void* item)
+{
+	if (deque == NULL)
+	{
+		return ERROR_LIST_NULL;
+	}
+	if (item == NULL)
+	{
+		return ERROR_ITEM_NULL;
+	}
+
+	uint64_t stackBuffer[WORK_DEQUE_BUFFER_WORDS];
+	void* buffer = GetBuffer(deque, stackBuffer);
+
+	if (buffer == NULL)
+	{
+		return ERROR_ELEMENT_NULL;
+	}
+
+	int result = ERROR_LIST_EMPTY;
+
+	while (1)
+	{
+		int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+
+		if (top >= bottom)
+		{
+			break;
+		}
+
+		/*
+		 * The slot may be overwritten by the owner once another thief has
+		 * taken it, in which case the copy is discarded by the failed swap.
+		 */
+		WorkDequeArray* array = __atomic_load_n(&deque->array, __ATOMIC_ACQUIRE);
+		LoadSlot(deque, GetSlot(deque, array, top), buffer);
+
+		if (__atomic_compare_exchange_n(&deque->top, &top, top + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+		{
+			memcpy(item, buffer, deque->dataSize);
+			result = 0;
+
+			break;
+		}
+	}
+
+	ReleaseBuffer(buffer, stackBuffer);
+
+	return result;
+}
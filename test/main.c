@@ -1,6 +1,17 @@
 #include "LinkedList/LinkedList.h"
+#include "LinkedList/ListSharded.h"
+#include "LinkedList/LockFreeList.h"
+#include "LinkedList/LruCache.h"
+#include "LinkedList/WorkDeque.h"
 #include "unity.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
 #define MY_RUN_TEST(func) RUN_TEST(func, 0)
 
@@ -669,6 +680,3040 @@ void ListReplace_LinkedListIndexAndReplaceItem_ReplacesItemAtIndexAndReturnsZero
 	ListDestroy(&list);
 }
 
+void ListGetRange_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	int items[2] = { 0 };
+
+	int resultTwo = ListGetRange(list, 0, 1, items);
+
+	ListPushBack(list, &items[0]);
+
+	int resultOne = ListGetRange(NULL, 0, 1, items);
+	int resultThree = ListGetRange(list, 0, 2, items);
+	int resultFour = ListGetRange(list, 0, 1, NULL);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_INDEX, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultFour);
+
+	ListDestroy(&list);
+}
+
+void ListGetRange_LinkedListStartAndCount_CopiesItemsIntoBufferAndReturnsZero(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 5; i++)
+	{
+		int item = i;
+		ListPushBack(list, &item);
+	}
+
+	int items[3] = { 0 };
+	int result = ListGetRange(list, 1, 3, items);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(1, items[0]);
+	TEST_ASSERT_EQUAL(2, items[1]);
+	TEST_ASSERT_EQUAL(3, items[2]);
+	TEST_ASSERT_EQUAL(5, ListCount(list));
+
+	ListDestroy(&list);
+}
+
+void ListPopRange_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	int item = 42;
+
+	int resultTwo = ListPopRange(list, 0, 1);
+
+	ListPushBack(list, &item);
+
+	int resultOne = ListPopRange(NULL, 0, 1);
+	int resultThree = ListPopRange(list, 1, 1);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_INDEX, resultThree);
+
+	ListDestroy(&list);
+}
+
+void ListPopRange_LinkedListStartAndCount_RemovesItemsDecreasesCountAndReturnsZero(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 5; i++)
+	{
+		int item = i;
+		ListPushBack(list, &item);
+	}
+
+	int result = ListPopRange(list, 1, 3);
+
+	int* valueOne = 0;
+	ListGetItem(list, 0, (void*)&valueOne);
+	int* valueTwo = 0;
+	ListGetItem(list, 1, (void*)&valueTwo);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(2, ListCount(list));
+	TEST_ASSERT_EQUAL(0, *valueOne);
+	TEST_ASSERT_EQUAL(4, *valueTwo);
+
+	ListDestroy(&list);
+}
+
+void ListPopRange_SharedElements_KeepsCloneAndPushesAfterTailRun(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 8; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	LinkedList* clone = ListClone(list);
+
+	int resultOne = ListPopRange(list, 2, 3);
+	int resultTwo = ListPopRange(clone, 5, 3);
+
+	int item = 42;
+	ListPushBack(clone, &item);
+
+	int expectedItems[5] = { 0, 1, 5, 6, 7 };
+	int expectedCloneItems[6] = { 0, 1, 2, 3, 4, 42 };
+
+	int items[6] = { 0 };
+	int cloneItems[6] = { 0 };
+	ListGetRange(list, 0, 5, items);
+	ListGetRange(clone, 0, 6, cloneItems);
+
+	TEST_ASSERT_EQUAL(0, resultOne);
+	TEST_ASSERT_EQUAL(0, resultTwo);
+	TEST_ASSERT_EQUAL(5, ListCount(list));
+	TEST_ASSERT_EQUAL(6, ListCount(clone));
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedItems, items, 5);
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedCloneItems, cloneItems, 6);
+
+	ListDestroy(&list);
+	ListDestroy(&clone);
+}
+
+void ListReplaceRange_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	int items[2] = { 0 };
+
+	int resultTwo = ListReplaceRange(list, 0, 1, items);
+
+	ListPushBack(list, &items[0]);
+
+	int resultOne = ListReplaceRange(NULL, 0, 1, items);
+	int resultThree = ListReplaceRange(list, 0, 2, items);
+	int resultFour = ListReplaceRange(list, 0, 1, NULL);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_INDEX, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultFour);
+
+	ListDestroy(&list);
+}
+
+void ListReplaceRange_LinkedListStartCountAndItems_ReplacesItemsAndReturnsZero(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 4; i++)
+	{
+		int item = i;
+		ListPushBack(list, &item);
+	}
+
+	int items[2] = { 42, 99 };
+	int result = ListReplaceRange(list, 2, 2, items);
+
+	int values[4] = { 0 };
+	ListGetRange(list, 0, 4, values);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(0, values[0]);
+	TEST_ASSERT_EQUAL(1, values[1]);
+	TEST_ASSERT_EQUAL(42, values[2]);
+	TEST_ASSERT_EQUAL(99, values[3]);
+	TEST_ASSERT_EQUAL(4, ListCount(list));
+
+	ListDestroy(&list);
+}
+
+static int IsItemGreaterThan(const void* item, void* ctx)
+{
+	return *(int*)item > *(int*)ctx;
+}
+
+void ListRemoveIf_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	int threshold = 0;
+	size_t removedCount = 0;
+
+	int resultOne = ListRemoveIf(NULL, IsItemGreaterThan, &threshold, &removedCount);
+	int resultTwo = ListRemoveIf(list, IsItemGreaterThan, &threshold, &removedCount);
+
+	ListPushBack(list, &threshold);
+
+	int resultThree = ListRemoveIf(list, NULL, &threshold, &removedCount);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultThree);
+	TEST_ASSERT_EQUAL(1, ListCount(list));
+
+	ListDestroy(&list);
+}
+
+void ListRemoveIf_LinkedListAndPredicate_RemovesMatchingItemsKeepsOrderAndReturnsZero(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 6; i++)
+	{
+		int item = i % 2 == 0 ? i : 10 + i;
+		ListPushBack(list, &item);
+	}
+
+	int threshold = 9;
+	size_t removedCount = 0;
+	int result = ListRemoveIf(list, IsItemGreaterThan, &threshold, &removedCount);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(3, removedCount);
+	TEST_ASSERT_EQUAL(3, ListCount(list));
+
+	for (int i = 0; i < 3; i++)
+	{
+		int* value = 0;
+		ListGetItem(list, i, (void*)&value);
+
+		TEST_ASSERT_EQUAL(i * 2, *value);
+	}
+
+	ListDestroy(&list);
+}
+
+void ListRetainIf_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	int threshold = 0;
+	size_t removedCount = 0;
+
+	int resultOne = ListRetainIf(NULL, IsItemGreaterThan, &threshold, &removedCount);
+	int resultTwo = ListRetainIf(list, IsItemGreaterThan, &threshold, &removedCount);
+
+	ListPushBack(list, &threshold);
+
+	int resultThree = ListRetainIf(list, NULL, &threshold, &removedCount);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultThree);
+	TEST_ASSERT_EQUAL(1, ListCount(list));
+
+	ListDestroy(&list);
+}
+
+void ListRetainIf_LinkedListAndPredicate_RemovesNonMatchingItemsKeepsOrderAndReturnsZero(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 5; i++)
+	{
+		int item = i;
+		ListPushBack(list, &item);
+	}
+
+	int threshold = 2;
+	size_t removedCount = 0;
+	int result = ListRetainIf(list, IsItemGreaterThan, &threshold, &removedCount);
+
+	int* valueOne = 0;
+	ListGetItem(list, 0, (void*)&valueOne);
+	int* valueTwo = 0;
+	ListGetItem(list, 1, (void*)&valueTwo);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(3, removedCount);
+	TEST_ASSERT_EQUAL(2, ListCount(list));
+	TEST_ASSERT_EQUAL(3, *valueOne);
+	TEST_ASSERT_EQUAL(4, *valueTwo);
+
+	ListDestroy(&list);
+}
+
+void ListClone_IllegalParameters_ReturnsNull(void)
+{
+	LinkedList* clone = ListClone(NULL);
+
+	TEST_ASSERT_NULL(clone);
+}
+
+void ListClone_LinkedList_ReturnsListWithSameItemsAndCount(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 3; i++)
+	{
+		int item = i;
+		ListPushBack(list, &item);
+	}
+
+	LinkedList* clone = ListClone(list);
+
+	int values[3] = { 0 };
+	int result = ListGetRange(clone, 0, 3, values);
+
+	TEST_ASSERT_NOT_NULL(clone);
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(3, ListCount(clone));
+	TEST_ASSERT_EQUAL(0, values[0]);
+	TEST_ASSERT_EQUAL(1, values[1]);
+	TEST_ASSERT_EQUAL(2, values[2]);
+
+	ListDestroy(&list);
+	ListDestroy(&clone);
+}
+
+void ListClone_ModifyListAfterClone_CloneKeepsOriginalItems(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 4; i++)
+	{
+		int item = i;
+		ListPushBack(list, &item);
+	}
+
+	LinkedList* clone = ListClone(list);
+
+	int replaceItem = 42;
+	ListReplace(list, 2, &replaceItem);
+	ListPopFront(list);
+	ListPopAt(list, 1);
+	int item = 99;
+	ListPushBack(list, &item);
+
+	int listValues[3] = { 0 };
+	ListGetRange(list, 0, 3, listValues);
+	int cloneValues[4] = { 0 };
+	ListGetRange(clone, 0, 4, cloneValues);
+
+	TEST_ASSERT_EQUAL(3, ListCount(list));
+	TEST_ASSERT_EQUAL(1, listValues[0]);
+	TEST_ASSERT_EQUAL(3, listValues[1]);
+	TEST_ASSERT_EQUAL(99, listValues[2]);
+	TEST_ASSERT_EQUAL(4, ListCount(clone));
+
+	for (int i = 0; i < 4; i++)
+	{
+		TEST_ASSERT_EQUAL(i, cloneValues[i]);
+	}
+
+	ListDestroy(&clone);
+	ListDestroy(&list);
+}
+
+void ListClone_ModifyCloneAfterClone_ListKeepsOriginalItems(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 4; i++)
+	{
+		int item = i;
+		ListPushBack(list, &item);
+	}
+
+	LinkedList* clone = ListClone(list);
+
+	int threshold = 1;
+	ListRemoveIf(clone, IsItemGreaterThan, &threshold, NULL);
+	ListClear(clone);
+
+	int listValues[4] = { 0 };
+	ListGetRange(list, 0, 4, listValues);
+
+	TEST_ASSERT_EQUAL(0, ListCount(clone));
+	TEST_ASSERT_EQUAL(4, ListCount(list));
+
+	for (int i = 0; i < 4; i++)
+	{
+		TEST_ASSERT_EQUAL(i, listValues[i]);
+	}
+
+	ListDestroy(&list);
+	ListDestroy(&clone);
+}
+
+void ListInsertSorted_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+	LinkedList* sortedList = ListInitialiseSorted(sizeof(int), CompareItems);
+
+	int item = 42;
+
+	int resultOne = ListInsertSorted(NULL, &item);
+	int resultTwo = ListInsertSorted(list, &item);
+	int resultThree = ListInsertSorted(sortedList, NULL);
+	int resultFour = ListPushBack(sortedList, &item);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultFour);
+
+	ListDestroy(&list);
+	ListDestroy(&sortedList);
+}
+
+void ListInsertSorted_SortedListUnorderedItems_KeepsItemsOrderedAndReturnsZero(void)
+{
+	LinkedList* list = ListInitialiseSorted(sizeof(int), CompareItems);
+
+	int result = 0;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		int item = (i * 7919) % 1000;
+		result |= ListInsertSorted(list, &item);
+	}
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(1000, ListCount(list));
+
+	for (int i = 0; i < 1000; i++)
+	{
+		int* value = 0;
+		ListGetItem(list, i, (void*)&value);
+
+		TEST_ASSERT_EQUAL(i, *value);
+	}
+
+	ListDestroy(&list);
+}
+
+void ListFindSorted_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialiseSorted(sizeof(int), CompareItems);
+
+	int item = 42;
+	size_t index = 0;
+
+	int resultTwo = ListFindSorted(list, &index, &item);
+
+	ListInsertSorted(list, &item);
+
+	int resultOne = ListFindSorted(NULL, &index, &item);
+	int resultThree = ListFindSorted(list, NULL, &item);
+	int resultFour = ListFindSorted(list, &index, NULL);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INDEX_NULL, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultFour);
+
+	ListDestroy(&list);
+}
+
+void ListFindSorted_SortedListAfterPops_GetsIndexByPointerAndReturnsZero(void)
+{
+	LinkedList* list = ListInitialiseSorted(sizeof(int), CompareItems);
+
+	for (int i = 0; i < 500; i++)
+	{
+		int item = i * 2;
+		ListInsertSorted(list, &item);
+	}
+
+	ListPopFront(list);
+	ListPopAt(list, 100);
+	ListPopRange(list, 200, 50);
+	ListPopBack(list);
+
+	for (size_t i = 0; i < ListCount(list); i++)
+	{
+		int* value = 0;
+		ListGetItem(list, i, (void*)&value);
+
+		size_t index = 0;
+		int result = ListFindSorted(list, &index, value);
+
+		TEST_ASSERT_EQUAL(0, result);
+		TEST_ASSERT_EQUAL(i, index);
+	}
+
+	int missingItem = 3;
+	size_t index = 0;
+	int result = ListFindSorted(list, &index, &missingItem);
+
+	TEST_ASSERT_EQUAL(ERROR_INVALID_ITEM, result);
+
+	ListDestroy(&list);
+}
+
+void ListLowerBound_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialiseSorted(sizeof(int), CompareItems);
+
+	int item = 42;
+	size_t index = 0;
+
+	int resultTwo = ListLowerBound(list, &index, &item);
+
+	ListInsertSorted(list, &item);
+
+	int resultOne = ListLowerBound(NULL, &index, &item);
+	int resultThree = ListLowerBound(list, NULL, &item);
+	int resultFour = ListLowerBound(list, &index, NULL);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INDEX_NULL, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultFour);
+
+	ListDestroy(&list);
+}
+
+void ListLowerBound_SortedListAndItem_GetsIndexOfFirstItemNotLessAndReturnsZero(void)
+{
+	LinkedList* list = ListInitialiseSorted(sizeof(int), CompareItems);
+
+	for (int i = 0; i < 300; i++)
+	{
+		int item = i * 10;
+		ListInsertSorted(list, &item);
+	}
+
+	int item = 1234;
+	size_t index = 0;
+	int result = ListLowerBound(list, &index, &item);
+
+	int largeItem = 5000;
+	size_t largeIndex = 0;
+	ListLowerBound(list, &largeIndex, &largeItem);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(124, index);
+	TEST_ASSERT_EQUAL(300, largeIndex);
+
+	ListDestroy(&list);
+}
+
+void ListInsertSorted_SortedListClone_CloneKeepsOriginalItems(void)
+{
+	LinkedList* list = ListInitialiseSorted(sizeof(int), CompareItems);
+
+	for (int i = 0; i < 100; i++)
+	{
+		int item = i * 2;
+		ListInsertSorted(list, &item);
+	}
+
+	LinkedList* clone = ListClone(list);
+
+	int item = 51;
+	ListInsertSorted(list, &item);
+
+	size_t listIndex = 0;
+	int listResult = ListFindSorted(list, &listIndex, &item);
+	size_t cloneIndex = 0;
+	int cloneResult = ListFindSorted(clone, &cloneIndex, &item);
+
+	TEST_ASSERT_EQUAL(0, listResult);
+	TEST_ASSERT_EQUAL(26, listIndex);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_ITEM, cloneResult);
+	TEST_ASSERT_EQUAL(100, ListCount(clone));
+
+	ListDestroy(&list);
+	ListDestroy(&clone);
+}
+
+static void CountEviction(const void* key, void* value, void* ctx)
+{
+	(void)value;
+
+	*(int*)ctx += *(const int*)key;
+}
+
+void LruPut_IllegalParameters_ReturnsErrorCode(void)
+{
+	LruCache* cache = LruInitialise(2, sizeof(int), sizeof(int), NULL, NULL);
+
+	int key = 1;
+	int value = 42;
+
+	int resultOne = LruPut(NULL, &key, &value);
+	int resultTwo = LruPut(cache, NULL, &value);
+	int resultThree = LruPut(cache, &key, NULL);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultThree);
+
+	LruDestroy(&cache);
+	TEST_ASSERT_EQUAL(0, LruDestroy(&cache));
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, LruDestroy(NULL));
+}
+
+void LruPut_FullCache_EvictsLeastRecentlyUsedKeyAndCallsEvict(void)
+{
+	int evictedKeys = 0;
+	LruCache* cache = LruInitialise(3, sizeof(int), sizeof(int), CountEviction, &evictedKeys);
+
+	for (int key = 1; key <= 3; key++)
+	{
+		int value = key * 10;
+		LruPut(cache, &key, &value);
+	}
+
+	int hitKey = 1;
+	int* hitValue = 0;
+	LruGet(cache, &hitKey, (void*)&hitValue);
+
+	int newKey = 4;
+	int newValue = 40;
+	int result = LruPut(cache, &newKey, &newValue);
+
+	int evictedKey = 2;
+	int* evictedValue = 0;
+	int evictedResult = LruGet(cache, &evictedKey, (void*)&evictedValue);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(10, *hitValue);
+	TEST_ASSERT_EQUAL(2, evictedKeys);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_ITEM, evictedResult);
+	TEST_ASSERT_EQUAL(3, LruCount(cache));
+
+	LruDestroy(&cache);
+}
+
+void LruGet_IllegalParameters_ReturnsErrorCode(void)
+{
+	LruCache* cache = LruInitialise(2, sizeof(int), sizeof(int), NULL, NULL);
+
+	int key = 1;
+	int* value = 0;
+
+	int resultOne = LruGet(NULL, &key, (void*)&value);
+	int resultTwo = LruGet(cache, NULL, (void*)&value);
+	int resultThree = LruGet(cache, &key, NULL);
+	int resultFour = LruGet(cache, &key, (void*)&value);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_ITEM, resultFour);
+
+	LruDestroy(&cache);
+}
+
+void LruGet_ManyKeysThroughSmallCache_GetsMostRecentValues(void)
+{
+	LruCache* cache = LruInitialise(64, sizeof(int), sizeof(int), NULL, NULL);
+
+	for (int key = 0; key < 1000; key++)
+	{
+		int value = key * 2;
+		LruPut(cache, &key, &value);
+	}
+
+	for (int key = 0; key < 1000; key++)
+	{
+		int* value = 0;
+		int result = LruGet(cache, &key, (void*)&value);
+
+		TEST_ASSERT_EQUAL(key >= 936 ? 0 : ERROR_INVALID_ITEM, result);
+
+		if (result == 0)
+		{
+			TEST_ASSERT_EQUAL(key * 2, *value);
+		}
+	}
+
+	TEST_ASSERT_EQUAL(64, LruCount(cache));
+
+	LruDestroy(&cache);
+}
+
+typedef struct ConcurrentReader
+{
+	LinkedList* list;
+	int stop;
+	int invalidItems;
+	size_t reads;
+} ConcurrentReader;
+
+static void* ReadConcurrentList(void* argument)
+{
+	ConcurrentReader* reader = argument;
+
+	while (!__atomic_load_n(&reader->stop, __ATOMIC_ACQUIRE))
+	{
+		ListReadBegin(reader->list);
+
+		size_t count = ListCount(reader->list);
+		int* value = 0;
+
+		if (count > 0 && ListGetItem(reader->list, reader->reads % count, (void*)&value) == 0)
+		{
+			reader->invalidItems += *value < 0 || *value >= 1000;
+		}
+
+		int item = (int)(reader->reads % 1000);
+		size_t index = 0;
+		ListGetIndex(reader->list, &index, &item, CompareItems);
+
+		ListReadEnd(reader->list);
+
+		reader->reads++;
+	}
+
+	return NULL;
+}
+
+void ListReadBegin_IllegalParameters_ReturnsErrorCode(void)
+{
+	int resultOne = ListReadBegin(NULL);
+	int resultTwo = ListReadEnd(NULL);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultTwo);
+}
+
+void ListReadBegin_ConcurrentListWithWriter_ReadersSeeOnlyValidItems(void)
+{
+	LinkedList* list = ListInitialiseConcurrent(sizeof(int));
+
+	for (int i = 0; i < 100; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	ConcurrentReader readers[4];
+	pthread_t threads[4];
+
+	for (int i = 0; i < 4; i++)
+	{
+		readers[i] = (ConcurrentReader) { list, 0, 0, (size_t)i * 7 };
+		pthread_create(&threads[i], NULL, ReadConcurrentList, &readers[i]);
+	}
+
+	for (int i = 0; i < 20000; i++)
+	{
+		int item = i % 1000;
+
+		ListPushAt(list, (size_t)i % ListCount(list), &item);
+		ListReplace(list, (size_t)i % ListCount(list), &item);
+		ListPopFront(list);
+
+		if (i % 1000 == 0)
+		{
+			LinkedList* clone = ListClone(list);
+
+			ListPopAt(list, 1);
+			ListDestroy(&clone);
+			ListPushBack(list, &item);
+		}
+	}
+
+	int invalidItems = 0;
+
+	for (int i = 0; i < 4; i++)
+	{
+		__atomic_store_n(&readers[i].stop, 1, __ATOMIC_RELEASE);
+		pthread_join(threads[i], NULL);
+		invalidItems += readers[i].invalidItems;
+	}
+
+	TEST_ASSERT_EQUAL(0, invalidItems);
+	TEST_ASSERT_EQUAL(100, ListCount(list));
+
+	ListDestroy(&list);
+}
+
+typedef struct CountingAllocator
+{
+	size_t allocations;
+	size_t frees;
+	size_t allocatedBytes;
+} CountingAllocator;
+
+static void* CountingAlloc(void* ctx, size_t size)
+{
+	CountingAllocator* allocator = ctx;
+
+	allocator->allocations++;
+	allocator->allocatedBytes += size;
+
+	return malloc(size);
+}
+
+static void CountingFree(void* ctx, void* pointer, size_t size)
+{
+	CountingAllocator* allocator = ctx;
+
+	allocator->frees++;
+	allocator->allocatedBytes -= size;
+
+	free(pointer);
+}
+
+void ListInitialiseWithAllocator_IllegalParameters_ReturnsNull(void)
+{
+	ListAllocator allocator = { CountingAlloc, NULL, NULL };
+
+	LinkedList* listOne = ListInitialiseWithAllocator(sizeof(int), NULL);
+	LinkedList* listTwo = ListInitialiseWithAllocator(sizeof(int), &allocator);
+	LinkedList* listThree = ListInitialiseWithAllocator(0, &ListThreadCacheAllocator);
+
+	TEST_ASSERT_NULL(listOne);
+	TEST_ASSERT_NULL(listTwo);
+	TEST_ASSERT_NULL(listThree);
+}
+
+void ListInitialiseWithAllocator_CustomAllocator_RoutesEveryAllocationThroughAllocator(void)
+{
+	CountingAllocator counter = { 0, 0, 0 };
+	ListAllocator allocator = { CountingAlloc, CountingFree, &counter };
+
+	LinkedList* list = ListInitialiseWithAllocator(sizeof(int), &allocator);
+
+	for (int i = 0; i < 10; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	LinkedList* clone = ListClone(list);
+	int item = 42;
+	ListReplace(clone, 9, &item);
+	ListPopFront(list);
+
+	size_t allocations = counter.allocations;
+
+	ListDestroy(&clone);
+	ListDestroy(&list);
+
+	TEST_ASSERT_EQUAL(42, allocations);
+	TEST_ASSERT_EQUAL(counter.allocations, counter.frees);
+	TEST_ASSERT_EQUAL(0, counter.allocatedBytes);
+}
+
+void ListInitialiseWithAllocator_CustomAllocator_RoutesScratchMemoryThroughAllocator(void)
+{
+	CountingAllocator counter = { 0, 0, 0 };
+	ListAllocator allocator = { CountingAlloc, CountingFree, &counter };
+
+	LinkedList* list = ListInitialiseWithAllocator(sizeof(int), &allocator);
+
+	for (int i = 9; i >= 0; i--)
+	{
+		ListPushBack(list, &i);
+	}
+
+	size_t allocations = counter.allocations;
+	size_t indices[3] = { 7, 2, 5 };
+	void* items[3] = { NULL };
+
+	int sortResult = ListSortByKey(list, 0, sizeof(int));
+	int getResult = ListGetItems(list, indices, 3, items);
+
+	TEST_ASSERT_EQUAL(0, sortResult);
+	TEST_ASSERT_EQUAL(0, getResult);
+	TEST_ASSERT_EQUAL(7, *(int*)items[0]);
+	TEST_ASSERT_EQUAL(2, *(int*)items[1]);
+	TEST_ASSERT_EQUAL(5, *(int*)items[2]);
+	TEST_ASSERT_EQUAL(allocations + 2, counter.allocations);
+	TEST_ASSERT_EQUAL(counter.allocations, counter.frees + 21);
+
+	ListDestroy(&list);
+
+	TEST_ASSERT_EQUAL(counter.allocations, counter.frees);
+	TEST_ASSERT_EQUAL(0, counter.allocatedBytes);
+}
+
+void ListInitialiseWithAllocator_ThreadCacheAllocator_KeepsItemsAndReturnsList(void)
+{
+	LinkedList* list = ListInitialiseWithAllocator(sizeof(int), &ListThreadCacheAllocator);
+
+	for (int round = 0; round < 3; round++)
+	{
+		for (int i = 0; i < 100; i++)
+		{
+			ListPushFront(list, &i);
+		}
+
+		ListPopRange(list, 0, 50);
+	}
+
+	int* value = 0;
+	ListGetItem(list, 0, (void*)&value);
+
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_EQUAL(150, ListCount(list));
+	TEST_ASSERT_EQUAL(49, *value);
+
+	ListDestroy(&list);
+}
+
+static void AssertListsEqual(LinkedList* expectedList, LinkedList* actualList)
+{
+	TEST_ASSERT_EQUAL(ListCount(expectedList), ListCount(actualList));
+
+	for (size_t i = 0; i < ListCount(expectedList); i++)
+	{
+		int* expectedValue = 0;
+		ListGetItem(expectedList, i, (void*)&expectedValue);
+		int* actualValue = 0;
+		ListGetItem(actualList, i, (void*)&actualValue);
+
+		TEST_ASSERT_EQUAL(*expectedValue, *actualValue);
+	}
+}
+
+static void ApplyRandomOperations(LinkedList* expectedList, LinkedList* actualList, int operations)
+{
+	unsigned int state = 12345;
+
+	for (int i = 0; i < operations; i++)
+	{
+		state = state * 1103515245 + 12345;
+
+		int item = (int)(state >> 16) % 1000;
+		size_t count = ListCount(expectedList);
+		size_t index = count > 0 ? (state >> 8) % count : 0;
+
+		switch ((state >> 4) % 8)
+		{
+		case 0:
+		case 1:
+			TEST_ASSERT_EQUAL(ListPushBack(expectedList, &item), ListPushBack(actualList, &item));
+			break;
+		case 2:
+			TEST_ASSERT_EQUAL(ListPushFront(expectedList, &item), ListPushFront(actualList, &item));
+			break;
+		case 3:
+			TEST_ASSERT_EQUAL(ListPushAt(expectedList, index, &item), ListPushAt(actualList, index, &item));
+			break;
+		case 4:
+			TEST_ASSERT_EQUAL(ListPopFront(expectedList), ListPopFront(actualList));
+			break;
+		case 5:
+			TEST_ASSERT_EQUAL(ListPopBack(expectedList), ListPopBack(actualList));
+			break;
+		case 6:
+			TEST_ASSERT_EQUAL(ListPopAt(expectedList, index), ListPopAt(actualList, index));
+			break;
+		default:
+			TEST_ASSERT_EQUAL(ListReplace(expectedList, index, &item), ListReplace(actualList, index, &item));
+			break;
+		}
+	}
+
+	AssertListsEqual(expectedList, actualList);
+}
+
+void ListInitialiseDeque_ElementSize_ReturnsListAndCountZero(void)
+{
+	LinkedList* list = ListInitialiseDeque(sizeof(int));
+	LinkedList* invalidList = ListInitialiseDeque(0);
+
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_NULL(invalidList);
+	TEST_ASSERT_EQUAL(0, ListCount(list));
+	TEST_ASSERT_NULL(ListClone(list));
+
+	ListDestroy(&list);
+}
+
+void ListInitialiseDeque_RandomOperations_BehavesLikeLinkedList(void)
+{
+	LinkedList* expectedList = ListInitialise(sizeof(int));
+	LinkedList* actualList = ListInitialiseDeque(sizeof(int));
+
+	ApplyRandomOperations(expectedList, actualList, 20000);
+
+	int threshold = 500;
+	size_t expectedRemoved = 0;
+	ListRemoveIf(expectedList, IsItemGreaterThan, &threshold, &expectedRemoved);
+	size_t actualRemoved = 0;
+	ListRemoveIf(actualList, IsItemGreaterThan, &threshold, &actualRemoved);
+	ListPopRange(expectedList, 3, 10);
+	ListPopRange(actualList, 3, 10);
+
+	TEST_ASSERT_EQUAL(expectedRemoved, actualRemoved);
+	AssertListsEqual(expectedList, actualList);
+
+	ListDestroy(&expectedList);
+	ListDestroy(&actualList);
+}
+
+void ListInitialiseRing_IllegalParameters_ReturnsNull(void)
+{
+	LinkedList* listOne = ListInitialiseRing(0, 8);
+	LinkedList* listTwo = ListInitialiseRing(sizeof(int), 0);
+
+	TEST_ASSERT_NULL(listOne);
+	TEST_ASSERT_NULL(listTwo);
+}
+
+void ListInitialiseRing_CapacityBeyondLargestPowerOfTwo_ReturnsNull(void)
+{
+	LinkedList* listOne = ListInitialiseRing(4, SIZE_MAX);
+	LinkedList* listTwo = ListInitialiseRing(4, (SIZE_MAX >> 1) + 2);
+
+	TEST_ASSERT_NULL(listOne);
+	TEST_ASSERT_NULL(listTwo);
+}
+
+void ListInitialiseRing_SlotsSizeOverflows_ReturnsNull(void)
+{
+	LinkedList* list = ListInitialiseRing(64, ((size_t)1 << 60) + 1);
+
+	TEST_ASSERT_NULL(list);
+}
+
+void ListInitialiseRing_FullRing_PushBackReturnsErrorListFull(void)
+{
+	LinkedList* list = ListInitialiseRing(sizeof(int), 3);
+
+	int result = 0;
+
+	for (int i = 0; i < 4; i++)
+	{
+		result |= ListPushBack(list, &i);
+	}
+
+	int item = 42;
+	int fullResult = ListPushBack(list, &item);
+	int pushFrontResult = ListPushFront(list, &item);
+	int popBackResult = ListPopBack(list);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(ERROR_LIST_FULL, fullResult);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, pushFrontResult);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, popBackResult);
+	TEST_ASSERT_EQUAL(4, ListCount(list));
+
+	ListDestroy(&list);
+}
+
+void ListPushBackMany_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialiseRing(sizeof(int), 4);
+
+	int items[2] = { 0 };
+	size_t count = 0;
+
+	int resultOne = ListPushBackMany(NULL, items, 2, &count);
+	int resultTwo = ListPushBackMany(list, NULL, 2, &count);
+	int resultThree = ListPopFrontMany(NULL, items, 2, &count);
+	int resultFour = ListPopFrontMany(list, items, 2, &count);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultFour);
+
+	ListDestroy(&list);
+}
+
+void ListPushBackMany_RingAcrossWrapAround_KeepsItemsInOrder(void)
+{
+	LinkedList* list = ListInitialiseRing(sizeof(int), 8);
+	LinkedList* nodeList = ListInitialise(sizeof(int));
+
+	int items[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+	size_t pushedCount = 0;
+	size_t poppedCount = 0;
+
+	ListPushBackMany(list, items, 6, &pushedCount);
+	ListPopFrontMany(list, NULL, 5, &poppedCount);
+
+	int result = ListPushBackMany(list, items, 8, &pushedCount);
+
+	int values[8] = { 0 };
+	ListPopFrontMany(list, values, 8, &poppedCount);
+
+	ListPushBackMany(nodeList, items, 8, NULL);
+	int nodeValues[3] = { 0 };
+	size_t nodePoppedCount = 0;
+	ListPopFrontMany(nodeList, nodeValues, 3, &nodePoppedCount);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(7, pushedCount);
+	TEST_ASSERT_EQUAL(8, poppedCount);
+	TEST_ASSERT_EQUAL(5, values[0]);
+
+	for (int i = 1; i < 8; i++)
+	{
+		TEST_ASSERT_EQUAL(i - 1, values[i]);
+	}
+
+	TEST_ASSERT_EQUAL(3, nodePoppedCount);
+	TEST_ASSERT_EQUAL(2, nodeValues[2]);
+	TEST_ASSERT_EQUAL(5, ListCount(nodeList));
+
+	ListDestroy(&list);
+	ListDestroy(&nodeList);
+}
+
+static void* ProduceRingItems(void* argument)
+{
+	LinkedList* list = argument;
+
+	for (int i = 0; i < 100000;)
+	{
+		if (ListPushBack(list, &i) == 0)
+		{
+			i++;
+		}
+		else
+		{
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+void ListInitialiseRing_ProducerAndConsumerThreads_ConsumerGetsItemsInOrder(void)
+{
+	LinkedList* list = ListInitialiseRing(sizeof(int), 64);
+	pthread_t producer;
+
+	pthread_create(&producer, NULL, ProduceRingItems, list);
+
+	int expectedItem = 0;
+	int outOfOrderItems = 0;
+
+	while (expectedItem < 100000)
+	{
+		int items[16];
+		size_t poppedCount = 0;
+
+		if (ListPopFrontMany(list, items, 16, &poppedCount) != 0)
+		{
+			sched_yield();
+			continue;
+		}
+
+		for (size_t i = 0; i < poppedCount; i++)
+		{
+			outOfOrderItems += items[i] != expectedItem++;
+		}
+	}
+
+	pthread_join(producer, NULL);
+
+	TEST_ASSERT_EQUAL(0, outOfOrderItems);
+	TEST_ASSERT_EQUAL(0, ListCount(list));
+
+	ListDestroy(&list);
+}
+
+void WorkDequeInitialise_IllegalParameters_ReturnsNull(void)
+{
+	WorkDeque* deque = WorkDequeInitialise(0);
+
+	TEST_ASSERT_NULL(deque);
+}
+
+void WorkDequePush_IllegalParameters_ReturnsErrorCode(void)
+{
+	WorkDeque* deque = WorkDequeInitialise(sizeof(int));
+
+	int item = 0;
+
+	int resultOne = WorkDequePush(NULL, &item);
+	int resultTwo = WorkDequePush(deque, NULL);
+	int resultThree = WorkDequePop(deque, &item);
+	int resultFour = WorkDequeSteal(deque, &item);
+	int resultFive = WorkDequeSteal(deque, NULL);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultFour);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultFive);
+
+	WorkDequeDestroy(&deque);
+}
+
+void WorkDequePush_PastInitialCapacity_PopTakesNewestAndStealTakesOldest(void)
+{
+	WorkDeque* deque = WorkDequeInitialise(sizeof(int));
+
+	for (int i = 0; i < 1000; i++)
+	{
+		WorkDequePush(deque, &i);
+	}
+
+	int poppedItem = 0;
+	int stolenItem = 0;
+
+	WorkDequePop(deque, &poppedItem);
+	WorkDequeSteal(deque, &stolenItem);
+
+	TEST_ASSERT_EQUAL(999, poppedItem);
+	TEST_ASSERT_EQUAL(0, stolenItem);
+	TEST_ASSERT_EQUAL(998, WorkDequeCount(deque));
+
+	WorkDequeDestroy(&deque);
+	TEST_ASSERT_NULL(deque);
+	TEST_ASSERT_EQUAL(0, WorkDequeDestroy(&deque));
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, WorkDequeDestroy(NULL));
+}
+
+typedef struct WorkDequeThief
+{
+	WorkDeque* deque;
+	int* takenCounts;
+	int* stop;
+} WorkDequeThief;
+
+static void* StealWorkItems(void* argument)
+{
+	WorkDequeThief* thief = argument;
+	int item = 0;
+
+	while (!__atomic_load_n(thief->stop, __ATOMIC_ACQUIRE) || WorkDequeCount(thief->deque) > 0)
+	{
+		if (WorkDequeSteal(thief->deque, &item) == 0)
+		{
+			__atomic_fetch_add(&thief->takenCounts[item], 1, __ATOMIC_RELAXED);
+		}
+		else
+		{
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+void WorkDequeSteal_OwnerAndThieves_TakeEveryItemExactlyOnce(void)
+{
+	enum { ItemCount = 50000, ThiefCount = 3 };
+	WorkDeque* deque = WorkDequeInitialise(sizeof(int));
+	int* takenCounts = calloc(ItemCount, sizeof(int));
+	int stop = 0;
+	pthread_t threads[ThiefCount];
+	WorkDequeThief thief = { deque, takenCounts, &stop };
+
+	for (int i = 0; i < ThiefCount; i++)
+	{
+		pthread_create(&threads[i], NULL, StealWorkItems, &thief);
+	}
+
+	for (int i = 0; i < ItemCount; i++)
+	{
+		WorkDequePush(deque, &i);
+
+		int item = 0;
+
+		if (i % 3 == 0 && WorkDequePop(deque, &item) == 0)
+		{
+			__atomic_fetch_add(&takenCounts[item], 1, __ATOMIC_RELAXED);
+		}
+	}
+
+	__atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+
+	for (int i = 0; i < ThiefCount; i++)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	int wrongCounts = 0;
+
+	for (int i = 0; i < ItemCount; i++)
+	{
+		wrongCounts += takenCounts[i] != 1;
+	}
+
+	TEST_ASSERT_EQUAL(0, wrongCounts);
+
+	free(takenCounts);
+	WorkDequeDestroy(&deque);
+}
+
+void ListInitialiseCompact_ElementSize_ReturnsListAndCountZero(void)
+{
+	LinkedList* list = ListInitialiseCompact(sizeof(int));
+	LinkedList* invalidList = ListInitialiseCompact(0);
+
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_NULL(invalidList);
+	TEST_ASSERT_EQUAL(0, ListCount(list));
+	TEST_ASSERT_NULL(ListClone(list));
+
+	ListDestroy(&list);
+}
+
+void ListInitialiseCompact_RandomOperations_BehavesLikeLinkedList(void)
+{
+	LinkedList* expectedList = ListInitialise(sizeof(int));
+	LinkedList* actualList = ListInitialiseCompact(sizeof(int));
+
+	ApplyRandomOperations(expectedList, actualList, 20000);
+
+	int threshold = 500;
+	size_t expectedRemoved = 0;
+	ListRemoveIf(expectedList, IsItemGreaterThan, &threshold, &expectedRemoved);
+	size_t actualRemoved = 0;
+	ListRemoveIf(actualList, IsItemGreaterThan, &threshold, &actualRemoved);
+	ListPopRange(expectedList, 3, 10);
+	ListPopRange(actualList, 3, 10);
+
+	TEST_ASSERT_EQUAL(expectedRemoved, actualRemoved);
+	AssertListsEqual(expectedList, actualList);
+
+	ListDestroy(&expectedList);
+	ListDestroy(&actualList);
+}
+
+void ListInitialiseCompact_ReusedNodesAcrossChunks_KeepsItemsInOrder(void)
+{
+	LinkedList* list = ListInitialiseCompact(sizeof(int));
+
+	for (int i = 0; i < 10000; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	ListPopRange(list, 0, 5000);
+
+	for (int i = 10000; i < 15000; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	int* items = malloc(10000 * sizeof(int));
+	int result = ListGetRange(list, 0, 10000, items);
+	int wrongItems = 0;
+
+	for (int i = 0; i < 10000; i++)
+	{
+		wrongItems += items[i] != i + 5000;
+	}
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(10000, ListCount(list));
+	TEST_ASSERT_EQUAL(0, wrongItems);
+
+	free(items);
+	ListDestroy(&list);
+}
+
+void ListClearIncremental_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	int resultOne = ListClearIncremental(NULL, 4);
+	int resultTwo = ListClearIncremental(list, 4);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+
+	ListDestroy(&list);
+}
+
+void ListClearIncremental_Budget_RemovesAtMostBudgetElementsPerCall(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 10; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	int result = ListClearIncremental(list, 4);
+
+	int* item = 0;
+	ListGetItem(list, 0, (void*)&item);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(6, ListCount(list));
+	TEST_ASSERT_EQUAL(4, *item);
+
+	int calls = 0;
+
+	while (ListClearIncremental(list, 4) == 0)
+	{
+		calls++;
+	}
+
+	TEST_ASSERT_EQUAL(2, calls);
+	TEST_ASSERT_EQUAL(0, ListCount(list));
+
+	ListDestroy(&list);
+}
+
+void ListClearIncremental_SharedElements_KeepsCloneIntact(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 10; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	LinkedList* clone = ListClone(list);
+
+	while (ListClearIncremental(list, 3) == 0)
+	{
+	}
+
+	int* item = 0;
+	ListGetItem(clone, 9, (void*)&item);
+
+	TEST_ASSERT_EQUAL(0, ListCount(list));
+	TEST_ASSERT_EQUAL(10, ListCount(clone));
+	TEST_ASSERT_EQUAL(9, *item);
+
+	ListDestroy(&list);
+	ListDestroy(&clone);
+}
+
+static void* LiveCountingAlloc(void* ctx, size_t size)
+{
+	__atomic_add_fetch((size_t*)ctx, 1, __ATOMIC_RELAXED);
+
+	return malloc(size);
+}
+
+static void LiveCountingFree(void* ctx, void* pointer, size_t size)
+{
+	(void)size;
+
+	free(pointer);
+	__atomic_sub_fetch((size_t*)ctx, 1, __ATOMIC_RELEASE);
+}
+
+void ListDestroyAsync_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = NULL;
+
+	int resultOne = ListDestroyAsync(NULL);
+	int resultTwo = ListDestroyAsync(&list);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(0, resultTwo);
+}
+
+void ListDestroyAsync_CustomAllocator_FreesEveryAllocationInBackground(void)
+{
+	size_t liveAllocations = 0;
+	ListAllocator allocator = { LiveCountingAlloc, LiveCountingFree, &liveAllocations };
+
+	LinkedList* list = ListInitialiseWithAllocator(sizeof(int), &allocator);
+
+	for (int i = 0; i < 10000; i++)
+	{
+		ListPushFront(list, &i);
+	}
+
+	int result = ListDestroyAsync(&list);
+
+	for (int i = 0; i < 10000000 && __atomic_load_n(&liveAllocations, __ATOMIC_ACQUIRE) > 0; i++)
+	{
+		sched_yield();
+	}
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_NULL(list);
+	TEST_ASSERT_EQUAL(0, __atomic_load_n(&liveAllocations, __ATOMIC_ACQUIRE));
+}
+
+void ListGetItems_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	size_t indices[2] = { 0, 1 };
+	void* items[2] = { NULL };
+
+	int resultOne = ListGetItems(NULL, indices, 2, items);
+	int resultTwo = ListGetItems(list, indices, 2, items);
+
+	int item = 42;
+	ListPushBack(list, &item);
+
+	int resultThree = ListGetItems(list, NULL, 2, items);
+	int resultFour = ListGetItems(list, indices, 2, NULL);
+	int resultFive = ListGetItems(list, indices, 2, items);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INDEX_NULL, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultFour);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_INDEX, resultFive);
+
+	ListDestroy(&list);
+}
+
+void ListGetItems_UnorderedIndices_ReturnsItemsInCallerOrder(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 100; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	size_t indices[5] = { 70, 3, 99, 3, 0 };
+	int* items[5] = { NULL };
+
+	int result = ListGetItems(list, indices, 5, (void**)items);
+
+	TEST_ASSERT_EQUAL(0, result);
+
+	for (int i = 0; i < 5; i++)
+	{
+		TEST_ASSERT_EQUAL((int)indices[i], *items[i]);
+	}
+
+	ListDestroy(&list);
+}
+
+void ListGetItems_DequeList_ReturnsItemsInCallerOrder(void)
+{
+	LinkedList* list = ListInitialiseDeque(sizeof(int));
+
+	for (int i = 0; i < 100; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	size_t indices[4] = { 10, 20, 5, 99 };
+	int* items[4] = { NULL };
+
+	int result = ListGetItems(list, indices, 4, (void**)items);
+
+	TEST_ASSERT_EQUAL(0, result);
+
+	for (int i = 0; i < 4; i++)
+	{
+		TEST_ASSERT_EQUAL((int)indices[i], *items[i]);
+	}
+
+	ListDestroy(&list);
+}
+
+void ListMergeSorted_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+	LinkedList* otherList = ListInitialise(sizeof(int));
+	LinkedList* dequeList = ListInitialiseDeque(sizeof(int));
+	LinkedList* wideList = ListInitialise(sizeof(long long));
+
+	int resultOne = ListMergeSorted(NULL, list, CompareItems);
+	int resultTwo = ListMergeSorted(list, otherList, NULL);
+	int resultThree = ListMergeSorted(list, list, CompareItems);
+	int resultFour = ListMergeSorted(list, dequeList, CompareItems);
+	int resultFive = ListMergeSorted(list, wideList, CompareItems);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultFour);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultFive);
+
+	ListDestroy(&list);
+	ListDestroy(&otherList);
+	ListDestroy(&dequeList);
+	ListDestroy(&wideList);
+}
+
+void ListMergeSorted_InterleavedLists_RelinksSourceIntoDestination(void)
+{
+	LinkedList* destination = ListInitialise(sizeof(int));
+	LinkedList* source = ListInitialise(sizeof(int));
+
+	int destinationItems[5] = { 1, 3, 5, 7, 9 };
+	int sourceItems[6] = { 0, 3, 4, 10, 11, 12 };
+	ListPushBackMany(destination, destinationItems, 5, NULL);
+	ListPushBackMany(source, sourceItems, 6, NULL);
+
+	void* sourceItem = NULL;
+	ListGetItem(source, 1, &sourceItem);
+
+	int result = ListMergeSorted(destination, source, CompareItems);
+
+	int expectedItems[11] = { 0, 1, 3, 3, 4, 5, 7, 9, 10, 11, 12 };
+	int items[11] = { 0 };
+	ListGetRange(destination, 0, 11, items);
+
+	void* mergedItem = NULL;
+	ListGetItem(destination, 3, &mergedItem);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(11, ListCount(destination));
+	TEST_ASSERT_EQUAL(0, ListCount(source));
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedItems, items, 11);
+	TEST_ASSERT_EQUAL_PTR(sourceItem, mergedItem);
+
+	ListDestroy(&destination);
+	ListDestroy(&source);
+}
+
+void ListMergeSorted_SortedDestinationWithClone_KeepsCloneAndFindsMergedItems(void)
+{
+	LinkedList* destination = ListInitialiseSorted(sizeof(int), CompareItems);
+	LinkedList* source = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 100; i += 2)
+	{
+		ListInsertSorted(destination, &i);
+	}
+
+	LinkedList* clone = ListClone(destination);
+
+	for (int i = 1; i < 100; i += 2)
+	{
+		ListPushBack(source, &i);
+	}
+
+	int result = ListMergeSorted(destination, source, NULL);
+
+	size_t index = 0;
+	int item = 77;
+	int findResult = ListFindSorted(destination, &index, &item);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(0, findResult);
+	TEST_ASSERT_EQUAL(77, index);
+	TEST_ASSERT_EQUAL(100, ListCount(destination));
+	TEST_ASSERT_EQUAL(50, ListCount(clone));
+
+	ListDestroy(&destination);
+	ListDestroy(&source);
+	ListDestroy(&clone);
+}
+
+void ListIntersectSorted_IllegalParameters_ReturnsNull(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+	LinkedList* wideList = ListInitialise(sizeof(long long));
+
+	TEST_ASSERT_NULL(ListIntersectSorted(NULL, list, CompareItems));
+	TEST_ASSERT_NULL(ListUnionSorted(list, list, NULL));
+	TEST_ASSERT_NULL(ListDifferenceSorted(list, wideList, CompareItems));
+
+	ListDestroy(&list);
+	ListDestroy(&wideList);
+}
+
+void ListIntersectSorted_ListsWithDuplicates_ReturnsMultisetResults(void)
+{
+	LinkedList* listOne = ListInitialise(sizeof(int));
+	LinkedList* listTwo = ListInitialiseDeque(sizeof(int));
+
+	int itemsOne[7] = { 1, 2, 2, 2, 5, 7, 9 };
+	int itemsTwo[5] = { 2, 2, 3, 7, 10 };
+	ListPushBackMany(listOne, itemsOne, 7, NULL);
+	ListPushBackMany(listTwo, itemsTwo, 5, NULL);
+
+	LinkedList* intersection = ListIntersectSorted(listOne, listTwo, CompareItems);
+	LinkedList* difference = ListDifferenceSorted(listOne, listTwo, CompareItems);
+	LinkedList* listUnion = ListUnionSorted(listOne, listTwo, CompareItems);
+
+	int expectedIntersection[3] = { 2, 2, 7 };
+	int expectedDifference[4] = { 1, 2, 5, 9 };
+	int expectedUnion[9] = { 1, 2, 2, 2, 3, 5, 7, 9, 10 };
+	int items[9] = { 0 };
+
+	TEST_ASSERT_EQUAL(3, ListCount(intersection));
+	ListGetRange(intersection, 0, 3, items);
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedIntersection, items, 3);
+
+	TEST_ASSERT_EQUAL(4, ListCount(difference));
+	ListGetRange(difference, 0, 4, items);
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedDifference, items, 4);
+
+	TEST_ASSERT_EQUAL(9, ListCount(listUnion));
+	ListGetRange(listUnion, 0, 9, items);
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedUnion, items, 9);
+
+	TEST_ASSERT_EQUAL(7, ListCount(listOne));
+	TEST_ASSERT_EQUAL(5, ListCount(listTwo));
+
+	ListDestroy(&listOne);
+	ListDestroy(&listTwo);
+	ListDestroy(&intersection);
+	ListDestroy(&difference);
+	ListDestroy(&listUnion);
+}
+
+static int CompareItemsReversed(const void* itemOne, const void* itemTwo)
+{
+	return CompareItems(itemTwo, itemOne);
+}
+
+void ListMergeSorted_SourceSortedByOtherCompare_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+	LinkedList* reversedList = ListInitialiseSorted(sizeof(int), CompareItemsReversed);
+
+	int result = ListMergeSorted(list, reversedList, CompareItems);
+
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, result);
+	TEST_ASSERT_NULL(ListUnionSorted(list, reversedList, CompareItems));
+
+	ListDestroy(&list);
+	ListDestroy(&reversedList);
+}
+
+void ListUnionSorted_SortedLists_ReturnsSortedList(void)
+{
+	LinkedList* listOne = ListInitialiseSorted(sizeof(int), CompareItems);
+	LinkedList* listTwo = ListInitialiseSorted(sizeof(int), CompareItems);
+	LinkedList* plainList = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 100; i++)
+	{
+		ListInsertSorted(i % 2 == 0 ? listOne : listTwo, &i);
+	}
+
+	LinkedList* listUnion = ListUnionSorted(listOne, listTwo, NULL);
+	LinkedList* intersection = ListIntersectSorted(listOne, plainList, NULL);
+
+	size_t index = 0;
+	int item = 77;
+	int findResult = ListFindSorted(listUnion, &index, &item);
+
+	item = 200;
+	int insertResult = ListInsertSorted(listUnion, &item);
+	int plainResult = ListInsertSorted(intersection, &item);
+
+	TEST_ASSERT_EQUAL(0, findResult);
+	TEST_ASSERT_EQUAL(77, index);
+	TEST_ASSERT_EQUAL(0, insertResult);
+	TEST_ASSERT_EQUAL(101, ListCount(listUnion));
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, plainResult);
+
+	ListDestroy(&listOne);
+	ListDestroy(&listTwo);
+	ListDestroy(&plainList);
+	ListDestroy(&listUnion);
+	ListDestroy(&intersection);
+}
+
+typedef struct SortRecord
+{
+	uint32_t id;
+	uint64_t key;
+} SortRecord;
+
+void ListSortByKey_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(SortRecord));
+	LinkedList* sortedList = ListInitialiseSorted(sizeof(SortRecord), CompareItems);
+
+	int resultOne = ListSortByKey(NULL, 0, 4);
+	int resultTwo = ListSortByKey(list, 0, 3);
+	int resultThree = ListSortByKey(list, sizeof(SortRecord) - 4, 8);
+	int resultFour = ListSortByKey(list, 0, 4);
+	int resultFive = ListSortByKey(sortedList, 0, 4);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_INDEX, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultFour);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultFive);
+
+	ListDestroy(&list);
+	ListDestroy(&sortedList);
+}
+
+void ListSortByKey_RandomKeys_SortsStablyWithoutMovingItems(void)
+{
+	LinkedList* list = ListInitialise(sizeof(SortRecord));
+	uint64_t state = 88172645463325252ULL;
+
+	for (uint32_t i = 0; i < 5000; i++)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		SortRecord record = { i, i % 7 == 0 ? 42 : state };
+		ListPushFront(list, &record);
+	}
+
+	void* firstItem = NULL;
+	ListGetItem(list, 0, &firstItem);
+
+	int result = ListSortByKey(list, offsetof(SortRecord, key), sizeof(uint64_t));
+
+	int unorderedRecords = 0;
+	int sameItems = 0;
+	SortRecord* previousRecord = NULL;
+
+	for (size_t i = 0; i < ListCount(list); i++)
+	{
+		SortRecord* record = NULL;
+		ListGetItem(list, i, (void*)&record);
+
+		if (previousRecord != NULL)
+		{
+			unorderedRecords += previousRecord->key > record->key ||
+				(previousRecord->key == record->key && previousRecord->id < record->id);
+		}
+
+		sameItems += record == firstItem;
+		previousRecord = record;
+	}
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(5000, ListCount(list));
+	TEST_ASSERT_EQUAL(0, unorderedRecords);
+	TEST_ASSERT_EQUAL(1, sameItems);
+
+	ListDestroy(&list);
+}
+
+void ListSortByKey_SharedElements_KeepsCloneOrder(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	int items[6] = { 5, 3, 9, 1, 3, 0 };
+	ListPushBackMany(list, items, 6, NULL);
+
+	LinkedList* clone = ListClone(list);
+
+	int result = ListSortByKey(list, 0, sizeof(int));
+
+	int expectedItems[6] = { 0, 1, 3, 3, 5, 9 };
+	int sortedItems[6] = { 0 };
+	int cloneItems[6] = { 0 };
+	ListGetRange(list, 0, 6, sortedItems);
+	ListGetRange(clone, 0, 6, cloneItems);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedItems, sortedItems, 6);
+	TEST_ASSERT_EQUAL_INT_ARRAY(items, cloneItems, 6);
+
+	ListDestroy(&list);
+	ListDestroy(&clone);
+}
+
+static uint64_t CountLatencySamples(const char* operation)
+{
+	uint64_t buckets[LIST_LATENCY_BUCKETS] = { 0 };
+	uint64_t samples = 0;
+
+	ListGetLatencyHistogram(operation, buckets);
+
+	for (size_t i = 0; i < LIST_LATENCY_BUCKETS; i++)
+	{
+		samples += buckets[i];
+	}
+
+	return samples;
+}
+
+void ListGetLatencyHistogram_IllegalParameters_ReturnsErrorCode(void)
+{
+	uint64_t buckets[LIST_LATENCY_BUCKETS] = { 0 };
+
+	int resultOne = ListGetLatencyHistogram(NULL, buckets);
+	int resultTwo = ListGetLatencyHistogram("ListPushBack", NULL);
+
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultTwo);
+}
+
+#ifdef LINKEDLIST_TRACING
+void ListGetLatencyHistogram_TracedOperations_CountsEveryCall(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	uint64_t pushSamples = CountLatencySamples("ListPushBack");
+	uint64_t getSamples = CountLatencySamples("ListGetItem");
+
+	for (int i = 0; i < 10; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	void* item = NULL;
+	ListGetItem(list, 9, &item);
+
+	uint64_t buckets[LIST_LATENCY_BUCKETS] = { 0 };
+	int unknownResult = ListGetLatencyHistogram("ListUnknown", buckets);
+
+	TEST_ASSERT_EQUAL(10, CountLatencySamples("ListPushBack") - pushSamples);
+	TEST_ASSERT_EQUAL(1, CountLatencySamples("ListGetItem") - getSamples);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_ITEM, unknownResult);
+
+	ListDestroy(&list);
+}
+#else
+void ListGetLatencyHistogram_TracingDisabled_ReturnsErrorInvalidOperation(void)
+{
+	uint64_t buckets[LIST_LATENCY_BUCKETS] = { 0 };
+
+	int result = ListGetLatencyHistogram("ListPushBack", buckets);
+
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, result);
+	TEST_ASSERT_EQUAL(0, CountLatencySamples("ListPushBack"));
+}
+#endif
+
+void ListRotate_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+	LinkedList* sortedList = ListInitialiseSorted(sizeof(int), CompareItems);
+
+	int item = 1;
+	ListInsertSorted(sortedList, &item);
+
+	int resultOne = ListRotate(NULL, 1);
+	int resultTwo = ListRotate(list, 1);
+	int resultThree = ListRotate(sortedList, 1);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultThree);
+
+	ListDestroy(&list);
+	ListDestroy(&sortedList);
+}
+
+void ListRotate_CountLargerThanList_MovesElementsWithoutCopyingItems(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	int items[5] = { 0, 1, 2, 3, 4 };
+	ListPushBackMany(list, items, 5, NULL);
+
+	void* firstItem = NULL;
+	ListGetItem(list, 0, &firstItem);
+
+	int result = ListRotate(list, 7);
+
+	int pushedItem = 5;
+	ListPushBack(list, &pushedItem);
+
+	int expectedItems[6] = { 2, 3, 4, 0, 1, 5 };
+	int rotatedItems[6] = { 0 };
+	ListGetRange(list, 0, 6, rotatedItems);
+
+	void* movedItem = NULL;
+	ListGetItem(list, 3, &movedItem);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedItems, rotatedItems, 6);
+	TEST_ASSERT_EQUAL_PTR(firstItem, movedItem);
+
+	ListDestroy(&list);
+}
+
+void ListRotate_SharedElements_KeepsCloneOrder(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	int items[4] = { 0, 1, 2, 3 };
+	ListPushBackMany(list, items, 4, NULL);
+
+	LinkedList* clone = ListClone(list);
+
+	ListRotate(list, 1);
+	ListPushBack(clone, &items[0]);
+
+	int expectedItems[4] = { 1, 2, 3, 0 };
+	int expectedCloneItems[5] = { 0, 1, 2, 3, 0 };
+	int rotatedItems[4] = { 0 };
+	int cloneItems[5] = { 0 };
+	ListGetRange(list, 0, 4, rotatedItems);
+	ListGetRange(clone, 0, 5, cloneItems);
+
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedItems, rotatedItems, 4);
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedCloneItems, cloneItems, 5);
+
+	ListDestroy(&list);
+	ListDestroy(&clone);
+}
+
+void ListRotate_RandomOperations_BehavesLikeDeque(void)
+{
+	LinkedList* expectedList = ListInitialiseDeque(sizeof(int));
+	LinkedList* actualList = ListInitialise(sizeof(int));
+	LinkedList* clone = NULL;
+	unsigned int state = 2463534242u;
+
+	for (int i = 0; i < 3000; i++)
+	{
+		state = state * 1103515245 + 12345;
+
+		int item = (int)(state >> 16) % 1000;
+		size_t count = ListCount(expectedList);
+		size_t index = count > 0 ? (state >> 8) % count : 0;
+
+		switch ((state >> 4) % 6)
+		{
+		case 0:
+			TEST_ASSERT_EQUAL(ListRotate(expectedList, index + 1), ListRotate(actualList, index + 1));
+			break;
+		case 1:
+			TEST_ASSERT_EQUAL(ListPopBack(expectedList), ListPopBack(actualList));
+			break;
+		case 2:
+			TEST_ASSERT_EQUAL(ListPopAt(expectedList, index), ListPopAt(actualList, index));
+			break;
+		case 3:
+			ListDestroy(&clone);
+			clone = ListClone(actualList);
+			break;
+		default:
+			TEST_ASSERT_EQUAL(ListPushBack(expectedList, &item), ListPushBack(actualList, &item));
+			break;
+		}
+	}
+
+	AssertListsEqual(expectedList, actualList);
+
+	ListDestroy(&expectedList);
+	ListDestroy(&actualList);
+	ListDestroy(&clone);
+}
+
+void ListCompact_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+	LinkedList* dequeList = ListInitialiseDeque(sizeof(int));
+	LinkedList* concurrentList = ListInitialiseConcurrent(sizeof(int));
+
+	double fragmentation = 0.0;
+
+	int resultOne = ListCompact(NULL);
+	int resultTwo = ListCompact(dequeList);
+	int resultThree = ListCompact(concurrentList);
+	int resultFour = ListFragmentation(NULL, &fragmentation);
+	int resultFive = ListFragmentation(list, NULL);
+	int resultSix = ListFragmentation(dequeList, &fragmentation);
+	int resultSeven = ListCompact(list);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultFour);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultFive);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultSix);
+	TEST_ASSERT_EQUAL(0, resultSeven);
+
+	ListDestroy(&list);
+	ListDestroy(&dequeList);
+	ListDestroy(&concurrentList);
+}
+
+void ListCompact_ScatteredList_KeepsItemsAndRemovesFragmentation(void)
+{
+	size_t liveAllocations = 0;
+	ListAllocator allocator = { LiveCountingAlloc, LiveCountingFree, &liveAllocations };
+
+	LinkedList* list = ListInitialiseWithAllocator(sizeof(int), &allocator);
+
+	for (int i = 0; i < 20000; i++)
+	{
+		ListPushFront(list, &i);
+	}
+
+	double fragmentationBefore = 0.0;
+	ListFragmentation(list, &fragmentationBefore);
+
+	int result = ListCompact(list);
+
+	double fragmentationAfter = 1.0;
+	ListFragmentation(list, &fragmentationAfter);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(20000, ListCount(list));
+	TEST_ASSERT_TRUE(fragmentationBefore > 0.5);
+	TEST_ASSERT_TRUE(fragmentationAfter < 0.01);
+	TEST_ASSERT_TRUE(liveAllocations < 100);
+
+	for (int i = 0; i < 20000; i++)
+	{
+		int* item = NULL;
+		ListGetItem(list, (size_t)i, (void**)&item);
+
+		TEST_ASSERT_EQUAL(19999 - i, *item);
+	}
+
+	ListPopRange(list, 100, 19000);
+
+	ListDestroy(&list);
+
+	TEST_ASSERT_EQUAL(0, liveAllocations);
+}
+
+void ListCompact_SharedElements_KeepsCloneItems(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	for (int i = 0; i < 100; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	LinkedList* clone = ListClone(list);
+
+	int result = ListCompact(list);
+
+	int item = -1;
+	ListReplace(list, 50, &item);
+	ListPopFront(list);
+
+	LinkedList* secondClone = ListClone(list);
+
+	ListCompact(secondClone);
+	ListPushBack(secondClone, &item);
+
+	int* cloneItem = NULL;
+	ListGetItem(clone, 50, (void**)&cloneItem);
+
+	int* listItem = NULL;
+	ListGetItem(list, 49, (void**)&listItem);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(100, ListCount(clone));
+	TEST_ASSERT_EQUAL(99, ListCount(list));
+	TEST_ASSERT_EQUAL(100, ListCount(secondClone));
+	TEST_ASSERT_EQUAL(50, *cloneItem);
+	TEST_ASSERT_EQUAL(-1, *listItem);
+
+	ListDestroy(&list);
+	ListDestroy(&clone);
+	ListDestroy(&secondClone);
+}
+
+void ListCompact_RandomOperations_BehavesLikeDeque(void)
+{
+	LinkedList* expectedList = ListInitialiseDeque(sizeof(int));
+	LinkedList* actualList = ListInitialise(sizeof(int));
+
+	for (int round = 0; round < 5; round++)
+	{
+		ApplyRandomOperations(expectedList, actualList, 2000);
+
+		TEST_ASSERT_EQUAL(0, ListCompact(actualList));
+
+		AssertListsEqual(expectedList, actualList);
+	}
+
+	ListDestroy(&expectedList);
+	ListDestroy(&actualList);
+}
+
+void ListInitialiseTiered_IllegalParameters_ReturnsNull(void)
+{
+	LinkedList* list = ListInitialiseTiered(sizeof(int), "LinkedListTest.spill", 0);
+	LinkedList* invalidListOne = ListInitialiseTiered(0, "LinkedListTest.spill", 0);
+	LinkedList* invalidListTwo = ListInitialiseTiered(sizeof(int), NULL, 0);
+	LinkedList* invalidListThree = ListInitialiseTiered(sizeof(int), "missing/LinkedListTest.spill", 0);
+
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_NULL(invalidListOne);
+	TEST_ASSERT_NULL(invalidListTwo);
+	TEST_ASSERT_NULL(invalidListThree);
+	TEST_ASSERT_EQUAL(0, ListCount(list));
+	TEST_ASSERT_NULL(ListClone(list));
+	TEST_ASSERT_NOT_EQUAL(0, access("LinkedListTest.spill", F_OK));
+
+	ListDestroy(&list);
+}
+
+void ListInitialiseTiered_RandomOperations_BehavesLikeDeque(void)
+{
+	LinkedList* expectedList = ListInitialiseDeque(sizeof(int));
+	LinkedList* actualList = ListInitialiseTiered(sizeof(int), "LinkedListTest.spill", 0);
+
+	for (int i = 0; i < 100000; i++)
+	{
+		ListPushBack(expectedList, &i);
+		ListPushBack(actualList, &i);
+	}
+
+	ApplyRandomOperations(expectedList, actualList, 20000);
+
+	int threshold = 500;
+	size_t expectedRemoved = 0;
+	ListRemoveIf(expectedList, IsItemGreaterThan, &threshold, &expectedRemoved);
+	size_t actualRemoved = 0;
+	ListRemoveIf(actualList, IsItemGreaterThan, &threshold, &actualRemoved);
+
+	TEST_ASSERT_EQUAL(expectedRemoved, actualRemoved);
+	AssertListsEqual(expectedList, actualList);
+
+	ListDestroy(&expectedList);
+	ListDestroy(&actualList);
+}
+
+void ListInitialiseTiered_QueueLargerThanBudget_KeepsItemsInOrder(void)
+{
+	LinkedList* list = ListInitialiseTiered(sizeof(int), "LinkedListTest.spill", 128 << 10);
+
+	for (int i = 0; i < 300000; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	for (int i = 0; i < 300000; i += 1000)
+	{
+		int item = -i;
+		ListReplace(list, (size_t)i, &item);
+	}
+
+	int wrongItems = 0;
+
+	for (int i = 0; i < 300000; i++)
+	{
+		int* item = NULL;
+		ListGetItem(list, 0, (void**)&item);
+
+		wrongItems += *item != (i % 1000 == 0 ? -i : i);
+
+		ListPopFront(list);
+	}
+
+	TEST_ASSERT_EQUAL(0, wrongItems);
+	TEST_ASSERT_EQUAL(0, ListCount(list));
+
+	ListDestroy(&list);
+}
+
+void ListInitialiseCompressed_ElementSize_ReturnsListForIntegerSizes(void)
+{
+	LinkedList* list = ListInitialiseCompressed(sizeof(uint32_t));
+	LinkedList* wideList = ListInitialiseCompressed(sizeof(uint64_t));
+	LinkedList* invalidListOne = ListInitialiseCompressed(0);
+	LinkedList* invalidListTwo = ListInitialiseCompressed(sizeof(SortRecord));
+
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_NOT_NULL(wideList);
+	TEST_ASSERT_NULL(invalidListOne);
+	TEST_ASSERT_NULL(invalidListTwo);
+	TEST_ASSERT_EQUAL(0, ListCount(list));
+	TEST_ASSERT_NULL(ListClone(list));
+
+	ListDestroy(&list);
+	ListDestroy(&wideList);
+}
+
+void ListInitialiseCompressed_RandomOperations_BehavesLikeDeque(void)
+{
+	LinkedList* expectedList = ListInitialiseDeque(sizeof(int));
+	LinkedList* actualList = ListInitialiseCompressed(sizeof(int));
+
+	for (int i = 0; i < 5000; i++)
+	{
+		int item = i % 3 == 0 ? -i : i * 7;
+
+		ListPushBack(expectedList, &item);
+		ListPushBack(actualList, &item);
+	}
+
+	ApplyRandomOperations(expectedList, actualList, 20000);
+
+	int threshold = 500;
+	size_t expectedRemoved = 0;
+	ListRemoveIf(expectedList, IsItemGreaterThan, &threshold, &expectedRemoved);
+	size_t actualRemoved = 0;
+	ListRemoveIf(actualList, IsItemGreaterThan, &threshold, &actualRemoved);
+	ListPopRange(expectedList, 3, 10);
+	ListPopRange(actualList, 3, 10);
+
+	TEST_ASSERT_EQUAL(expectedRemoved, actualRemoved);
+	AssertListsEqual(expectedList, actualList);
+
+	ListDestroy(&expectedList);
+	ListDestroy(&actualList);
+}
+
+void ListInitialiseCompressed_WideValues_KeepsEveryBit(void)
+{
+	LinkedList* list = ListInitialiseCompressed(sizeof(uint64_t));
+
+	uint64_t items[6] = { 0, UINT64_MAX, 1, (uint64_t)1 << 63, 42, UINT64_MAX - 1 };
+
+	for (int round = 0; round < 100; round++)
+	{
+		ListPushBackMany(list, items, 6, NULL);
+	}
+
+	uint64_t storedItems[600] = { 0 };
+	int result = ListGetRange(list, 0, 600, storedItems);
+	int wrongItems = 0;
+
+	for (int i = 0; i < 600; i++)
+	{
+		wrongItems += storedItems[i] != items[i % 6];
+	}
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(0, wrongItems);
+
+	ListDestroy(&list);
+}
+
+static void AssertItemsEqual(LinkedList* list, const int* expectedItems, size_t count)
+{
+	int* items = malloc(count * sizeof(int));
+
+	TEST_ASSERT_EQUAL(count, ListCount(list));
+	TEST_ASSERT_EQUAL(0, ListGetRange(list, 0, count, items));
+	TEST_ASSERT_EQUAL_INT_ARRAY(expectedItems, items, count);
+
+	free(items);
+}
+
+void ListInitialiseSelfOrganising_Organisation_ReturnsListForValidOrganisations(void)
+{
+	LinkedList* list = ListInitialiseSelfOrganising(sizeof(int), LIST_ORGANISATION_MOVE_TO_FRONT);
+	LinkedList* invalidListOne = ListInitialiseSelfOrganising(sizeof(int), LIST_ORGANISATION_NONE);
+	LinkedList* invalidListTwo = ListInitialiseSelfOrganising(sizeof(int), (ListOrganisation)42);
+
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_NULL(invalidListOne);
+	TEST_ASSERT_NULL(invalidListTwo);
+	TEST_ASSERT_EQUAL(0, ListCount(list));
+
+	ListDestroy(&list);
+}
+
+void ListGetIndex_MoveToFront_MovesFoundItemToFront(void)
+{
+	LinkedList* list = ListInitialiseSelfOrganising(sizeof(int), LIST_ORGANISATION_MOVE_TO_FRONT);
+
+	for (int i = 0; i < 5; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	size_t indexOne = 42;
+	size_t indexTwo = 42;
+	size_t indexThree = 42;
+	int item = 2;
+	int lastItem = 4;
+	int missingItem = 9;
+
+	ListGetIndex(list, &indexOne, &item, CompareItems);
+	ListGetIndex(list, &indexTwo, &lastItem, CompareItems);
+	int result = ListGetIndex(list, &indexThree, &missingItem, CompareItems);
+	ListPushBack(list, &missingItem);
+
+	int expectedItems[6] = { 4, 2, 0, 1, 3, 9 };
+
+	TEST_ASSERT_EQUAL(0, indexOne);
+	TEST_ASSERT_EQUAL(0, indexTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_ITEM, result);
+	AssertItemsEqual(list, expectedItems, 6);
+
+	ListDestroy(&list);
+}
+
+void ListGetIndex_Transpose_SwapsFoundItemWithPredecessor(void)
+{
+	LinkedList* list = ListInitialiseSelfOrganising(sizeof(int), LIST_ORGANISATION_TRANSPOSE);
+
+	for (int i = 0; i < 5; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	size_t indexOne = 42;
+	size_t indexTwo = 42;
+	size_t indexThree = 42;
+	int item = 4;
+	int firstItem = 0;
+
+	ListGetIndex(list, &indexOne, &item, CompareItems);
+	ListGetIndex(list, &indexTwo, &item, CompareItems);
+	ListGetIndex(list, &indexThree, &firstItem, CompareItems);
+	ListPushBack(list, &item);
+
+	int expectedItems[6] = { 0, 1, 4, 2, 3, 4 };
+
+	TEST_ASSERT_EQUAL(3, indexOne);
+	TEST_ASSERT_EQUAL(2, indexTwo);
+	TEST_ASSERT_EQUAL(0, indexThree);
+	AssertItemsEqual(list, expectedItems, 6);
+
+	ListDestroy(&list);
+}
+
+void ListGetIndex_FrequencyCount_OrdersItemsByHits(void)
+{
+	LinkedList* list = ListInitialiseSelfOrganising(sizeof(int), LIST_ORGANISATION_FREQUENCY);
+
+	for (int i = 0; i < 5; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	int lookups[6] = { 3, 1, 3, 4, 1, 3 };
+	size_t indices[6] = { 0 };
+
+	for (int i = 0; i < 6; i++)
+	{
+		ListGetIndex(list, &indices[i], &lookups[i], CompareItems);
+	}
+
+	size_t expectedIndices[6] = { 0, 1, 0, 2, 1, 0 };
+	int expectedItems[5] = { 3, 1, 4, 0, 2 };
+
+	for (int i = 0; i < 6; i++)
+	{
+		TEST_ASSERT_EQUAL(expectedIndices[i], indices[i]);
+	}
+
+	AssertItemsEqual(list, expectedItems, 5);
+
+	ListDestroy(&list);
+}
+
+void ListGetIndex_SelfOrganisingClone_KeepsOriginalOrder(void)
+{
+	LinkedList* list = ListInitialiseSelfOrganising(sizeof(int), LIST_ORGANISATION_MOVE_TO_FRONT);
+
+	for (int i = 0; i < 5; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	LinkedList* clone = ListClone(list);
+
+	size_t index = 42;
+	int item = 3;
+
+	ListGetIndex(clone, &index, &item, CompareItems);
+	ListPushBack(clone, &item);
+
+	int expectedItems[5] = { 0, 1, 2, 3, 4 };
+	int expectedCloneItems[6] = { 3, 0, 1, 2, 4, 3 };
+
+	TEST_ASSERT_EQUAL(0, index);
+	AssertItemsEqual(list, expectedItems, 5);
+	AssertItemsEqual(clone, expectedCloneItems, 6);
+
+	ListDestroy(&list);
+	ListDestroy(&clone);
+}
+
+void ListConcatenate_IllegalParameters_ReturnsErrorCode(void)
+{
+	LinkedList* list = ListInitialise(sizeof(int));
+	LinkedList* dequeList = ListInitialiseDeque(sizeof(int));
+	LinkedList* wideList = ListInitialise(sizeof(long long));
+	LinkedList* sortedList = ListInitialiseSorted(sizeof(int), CompareItems);
+
+	int resultOne = ListConcatenate(NULL, list);
+	int resultTwo = ListConcatenate(list, list);
+	int resultThree = ListConcatenate(list, dequeList);
+	int resultFour = ListConcatenate(list, wideList);
+	int resultFive = ListConcatenate(sortedList, list);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultFour);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultFive);
+
+	ListDestroy(&list);
+	ListDestroy(&dequeList);
+	ListDestroy(&wideList);
+	ListDestroy(&sortedList);
+}
+
+void ListConcatenate_TwoLists_MovesSourceBehindDestination(void)
+{
+	LinkedList* destination = ListInitialise(sizeof(int));
+	LinkedList* source = ListInitialise(sizeof(int));
+
+	int destinationItems[3] = { 1, 2, 3 };
+	int sourceItems[2] = { 4, 5 };
+	ListPushBackMany(destination, destinationItems, 3, NULL);
+	ListPushBackMany(source, sourceItems, 2, NULL);
+
+	void* sourceItem = NULL;
+	ListGetItem(source, 0, &sourceItem);
+
+	int result = ListConcatenate(destination, source);
+
+	int item = 6;
+	ListPushBack(destination, &item);
+	ListPushBack(source, &item);
+
+	void* movedItem = NULL;
+	ListGetItem(destination, 3, &movedItem);
+
+	int expectedItems[6] = { 1, 2, 3, 4, 5, 6 };
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL_PTR(sourceItem, movedItem);
+	AssertItemsEqual(destination, expectedItems, 6);
+	AssertItemsEqual(source, &item, 1);
+
+	ListDestroy(&destination);
+	ListDestroy(&source);
+}
+
+void ListConcatenate_EmptyDestination_TakesSourceElements(void)
+{
+	LinkedList* destination = ListInitialise(sizeof(int));
+	LinkedList* source = ListInitialise(sizeof(int));
+
+	int sourceItems[3] = { 7, 8, 9 };
+	ListPushBackMany(source, sourceItems, 3, NULL);
+
+	int resultOne = ListConcatenate(destination, source);
+	int resultTwo = ListConcatenate(destination, source);
+
+	TEST_ASSERT_EQUAL(0, resultOne);
+	TEST_ASSERT_EQUAL(0, resultTwo);
+	TEST_ASSERT_EQUAL(0, ListCount(source));
+	AssertItemsEqual(destination, sourceItems, 3);
+
+	ListDestroy(&destination);
+	ListDestroy(&source);
+}
+
+void ListConcatenate_SharedLists_KeepsClonesUnchanged(void)
+{
+	LinkedList* destination = ListInitialise(sizeof(int));
+	LinkedList* source = ListInitialise(sizeof(int));
+
+	int destinationItems[3] = { 1, 2, 3 };
+	int sourceItems[2] = { 4, 5 };
+	ListPushBackMany(destination, destinationItems, 3, NULL);
+	ListPushBackMany(source, sourceItems, 2, NULL);
+
+	LinkedList* destinationClone = ListClone(destination);
+	LinkedList* sourceClone = ListClone(source);
+
+	int result = ListConcatenate(destination, source);
+
+	int item = 42;
+	ListReplace(destination, 4, &item);
+
+	int expectedItems[5] = { 1, 2, 3, 4, 42 };
+
+	TEST_ASSERT_EQUAL(0, result);
+	AssertItemsEqual(destination, expectedItems, 5);
+	AssertItemsEqual(destinationClone, destinationItems, 3);
+	AssertItemsEqual(sourceClone, sourceItems, 2);
+
+	ListDestroy(&destination);
+	ListDestroy(&source);
+	ListDestroy(&destinationClone);
+	ListDestroy(&sourceClone);
+}
+
+void ListShardedInitialise_IllegalParameters_ReturnsNull(void)
+{
+	ListSharded* shardedOne = ListShardedInitialise(0, 4);
+	ListSharded* shardedTwo = ListShardedInitialise(sizeof(int), 0);
+
+	TEST_ASSERT_NULL(shardedOne);
+	TEST_ASSERT_NULL(shardedTwo);
+}
+
+void ListShardedPushBack_IllegalParameters_ReturnsErrorCode(void)
+{
+	ListSharded* sharded = ListShardedInitialise(sizeof(int), 2);
+	LinkedList* wideList = ListInitialise(sizeof(long long));
+
+	int item = 0;
+
+	int resultOne = ListShardedPushBack(NULL, 0, &item);
+	int resultTwo = ListShardedPushBack(sharded, 2, &item);
+	int resultThree = ListShardedPushBack(sharded, 0, NULL);
+	int resultFour = ListShardedCollect(sharded, NULL);
+	int resultFive = ListShardedCollect(sharded, wideList);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_INDEX, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultFour);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_OPERATION, resultFive);
+
+	ListShardedDestroy(&sharded);
+	ListDestroy(&wideList);
+	TEST_ASSERT_NULL(sharded);
+	TEST_ASSERT_EQUAL(0, ListShardedDestroy(&sharded));
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, ListShardedDestroy(NULL));
+}
+
+void ListShardedCollect_FilledShards_AppendsShardsInOrder(void)
+{
+	ListSharded* sharded = ListShardedInitialise(sizeof(int), 3);
+	LinkedList* list = ListInitialise(sizeof(int));
+
+	int item = 0;
+	ListPushBack(list, &item);
+
+	for (int i = 1; i <= 6; i++)
+	{
+		ListShardedPushBack(sharded, (size_t)(i % 3 == 0 ? 0 : 2), &i);
+	}
+
+	size_t shardedCount = ListShardedCount(sharded);
+	int result = ListShardedCollect(sharded, list);
+
+	int expectedItems[7] = { 0, 3, 6, 1, 2, 4, 5 };
+
+	TEST_ASSERT_EQUAL(6, shardedCount);
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(0, ListShardedCount(sharded));
+	AssertItemsEqual(list, expectedItems, 7);
+
+	ListShardedDestroy(&sharded);
+	ListDestroy(&list);
+}
+
+typedef struct ShardedWriter
+{
+	ListSharded* sharded;
+	size_t shard;
+	int itemCount;
+} ShardedWriter;
+
+static void* PushShardedItems(void* argument)
+{
+	ShardedWriter* writer = argument;
+
+	for (int i = 0; i < writer->itemCount; i++)
+	{
+		int item = (int)writer->shard * writer->itemCount + i;
+
+		ListShardedPushBack(writer->sharded, writer->shard, &item);
+	}
+
+	return NULL;
+}
+
+void ListShardedPushBack_ThreadPerShard_CollectKeepsEveryItemInOrder(void)
+{
+	enum { WriterCount = 4, ItemCount = 20000 };
+	ListSharded* sharded = ListShardedInitialise(sizeof(int), WriterCount);
+	LinkedList* list = ListInitialise(sizeof(int));
+	pthread_t threads[WriterCount];
+	ShardedWriter writers[WriterCount];
+
+	for (int i = 0; i < WriterCount; i++)
+	{
+		writers[i] = (ShardedWriter){ sharded, (size_t)i, ItemCount };
+		pthread_create(&threads[i], NULL, PushShardedItems, &writers[i]);
+	}
+
+	for (int i = 0; i < WriterCount; i++)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	int result = ListShardedCollect(sharded, list);
+	int* items = malloc(WriterCount * ItemCount * sizeof(int));
+	ListGetRange(list, 0, WriterCount * ItemCount, items);
+
+	int outOfOrderItems = 0;
+
+	for (int i = 0; i < WriterCount * ItemCount; i++)
+	{
+		outOfOrderItems += items[i] != i;
+	}
+
+	free(items);
+
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(WriterCount * ItemCount, ListCount(list));
+	TEST_ASSERT_EQUAL(0, outOfOrderItems);
+
+	ListShardedDestroy(&sharded);
+	ListDestroy(&list);
+}
+
+void LockFreeListInitialise_IllegalParameters_ReturnsNull(void)
+{
+	LockFreeList* listOne = LockFreeListInitialise(0, CompareItems);
+	LockFreeList* listTwo = LockFreeListInitialise(sizeof(int), NULL);
+
+	TEST_ASSERT_NULL(listOne);
+	TEST_ASSERT_NULL(listTwo);
+}
+
+void LockFreeListInsert_IllegalParameters_ReturnsErrorCode(void)
+{
+	LockFreeList* list = LockFreeListInitialise(sizeof(int), CompareItems);
+
+	int item = 0;
+
+	int resultOne = LockFreeListInsert(NULL, &item);
+	int resultTwo = LockFreeListInsert(list, NULL);
+	int resultThree = LockFreeListRemove(list, NULL);
+	int resultFour = LockFreeListRemove(list, &item);
+	int resultFive = LockFreeListContains(NULL, &item);
+
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultTwo);
+	TEST_ASSERT_EQUAL(ERROR_ITEM_NULL, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_ITEM, resultFour);
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, resultFive);
+
+	LockFreeListDestroy(&list);
+	TEST_ASSERT_NULL(list);
+	TEST_ASSERT_EQUAL(0, LockFreeListDestroy(&list));
+	TEST_ASSERT_EQUAL(ERROR_LIST_NULL, LockFreeListDestroy(NULL));
+}
+
+void LockFreeListInsert_ShuffledItems_KeepsEachItemOnce(void)
+{
+	LockFreeList* list = LockFreeListInitialise(sizeof(int), CompareItems);
+	int duplicates = 0;
+
+	for (int i = 0; i < 100; i++)
+	{
+		int item = i * 37 % 100;
+
+		LockFreeListInsert(list, &item);
+		duplicates += LockFreeListInsert(list, &item) == ERROR_INVALID_ITEM;
+	}
+
+	int item = 50;
+	int resultOne = LockFreeListRemove(list, &item);
+	int resultTwo = LockFreeListRemove(list, &item);
+	int containsOne = LockFreeListContains(list, &item);
+
+	item = 51;
+	int containsTwo = LockFreeListContains(list, &item);
+
+	item = 100;
+	int containsThree = LockFreeListContains(list, &item);
+
+	TEST_ASSERT_EQUAL(100, duplicates);
+	TEST_ASSERT_EQUAL(0, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_INVALID_ITEM, resultTwo);
+	TEST_ASSERT_EQUAL(0, containsOne);
+	TEST_ASSERT_EQUAL(1, containsTwo);
+	TEST_ASSERT_EQUAL(0, containsThree);
+	TEST_ASSERT_EQUAL(99, LockFreeListCount(list));
+
+	LockFreeListDestroy(&list);
+}
+
+typedef struct LockFreeWorker
+{
+	LockFreeList* list;
+	int keyCount;
+	int operationCount;
+	uint64_t seed;
+	int* insertedCounts;
+	int* removedCounts;
+	int missingItems;
+} LockFreeWorker;
+
+static void* ChangeLockFreeItems(void* argument)
+{
+	LockFreeWorker* worker = argument;
+	uint64_t state = worker->seed;
+
+	for (int i = 0; i < worker->operationCount; i++)
+	{
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+
+		int item = (int)(state >> 33) % worker->keyCount * 2;
+
+		if ((state >> 32) & 1)
+		{
+			worker->insertedCounts[item / 2] += LockFreeListInsert(worker->list, &item) == 0;
+		}
+		else
+		{
+			worker->removedCounts[item / 2] += LockFreeListRemove(worker->list, &item) == 0;
+		}
+
+		/*
+		 * The odd items are never removed, so they must stay visible while
+		 * their neighbours come and go.
+		 */
+		item++;
+		worker->missingItems += LockFreeListContains(worker->list, &item) != 1;
+	}
+
+	return NULL;
+}
+
+void LockFreeListRemove_RacingThreads_SuccessfulInsertsAndRemovesAlternate(void)
+{
+	enum { WorkerCount = 4, KeyCount = 64, OperationCount = 20000 };
+	LockFreeList* list = LockFreeListInitialise(sizeof(int), CompareItems);
+	pthread_t threads[WorkerCount];
+	LockFreeWorker workers[WorkerCount];
+
+	for (int i = 1; i < KeyCount * 2; i += 2)
+	{
+		LockFreeListInsert(list, &i);
+	}
+
+	for (int i = 0; i < WorkerCount; i++)
+	{
+		workers[i] = (LockFreeWorker){ list, KeyCount, OperationCount, (uint64_t)i * 7919 + 1,
+			calloc(KeyCount, sizeof(int)), calloc(KeyCount, sizeof(int)), 0 };
+		pthread_create(&threads[i], NULL, ChangeLockFreeItems, &workers[i]);
+	}
+
+	for (int i = 0; i < WorkerCount; i++)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	int unbalancedItems = 0;
+	int missingItems = 0;
+	size_t presentCount = KeyCount;
+
+	for (int i = 0; i < KeyCount; i++)
+	{
+		int balance = 0;
+		int item = i * 2;
+
+		for (int j = 0; j < WorkerCount; j++)
+		{
+			balance += workers[j].insertedCounts[i] - workers[j].removedCounts[i];
+		}
+
+		unbalancedItems += balance != LockFreeListContains(list, &item);
+		presentCount += (size_t)balance;
+	}
+
+	for (int i = 0; i < WorkerCount; i++)
+	{
+		missingItems += workers[i].missingItems;
+		free(workers[i].insertedCounts);
+		free(workers[i].removedCounts);
+	}
+
+	TEST_ASSERT_EQUAL(0, unbalancedItems);
+	TEST_ASSERT_EQUAL(0, missingItems);
+	TEST_ASSERT_EQUAL(presentCount, LockFreeListCount(list));
+
+	LockFreeListDestroy(&list);
+}
+
+void ListInitialiseTiered_ExistingFileAtPath_LeavesFileUntouched(void)
+{
+	FILE* file = fopen("LinkedListTest.keep", "w");
+	fputs("keep", file);
+	fclose(file);
+
+	LinkedList* list = ListInitialiseTiered(sizeof(int), "LinkedListTest.keep", 0);
+
+	for (int i = 0; i < 100000; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	ListDestroy(&list);
+
+	char contents[8] = { 0 };
+	file = fopen("LinkedListTest.keep", "r");
+	TEST_ASSERT_NOT_NULL(file);
+	fgets(contents, sizeof(contents), file);
+	fclose(file);
+	unlink("LinkedListTest.keep");
+
+	TEST_ASSERT_EQUAL_STRING("keep", contents);
+}
+
+void ListGetItems_TieredIndicesAcrossSegments_ReturnsEveryItem(void)
+{
+	LinkedList* list = ListInitialiseTiered(sizeof(int), "LinkedListTest.spill", 0);
+
+	for (int i = 0; i < 100000; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	size_t indices[6] = { 0, 20000, 40000, 60000, 80000, 99999 };
+	int* items[6] = { NULL };
+
+	int result = ListGetItems(list, indices, 6, (void**)items);
+
+	TEST_ASSERT_EQUAL(0, result);
+
+	for (size_t i = 0; i < 6; i++)
+	{
+		TEST_ASSERT_EQUAL(indices[i], *items[i]);
+	}
+
+	ListDestroy(&list);
+}
+
+void ListGetItems_CompressedIndicesAcrossBlocks_ReturnsEveryItem(void)
+{
+	LinkedList* list = ListInitialiseCompressed(sizeof(int));
+
+	for (int i = 0; i < 1000; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	size_t indices[5] = { 0, 300, 600, 900, 150 };
+	int* items[5] = { NULL };
+
+	int result = ListGetItems(list, indices, 5, (void**)items);
+
+	TEST_ASSERT_EQUAL(0, result);
+
+	for (size_t i = 0; i < 5; i++)
+	{
+		TEST_ASSERT_EQUAL(indices[i], *items[i]);
+	}
+
+	ListDestroy(&list);
+}
+
+void ListRemoveIf_CompactListLargeTail_DropsTailAndKeepsPushing(void)
+{
+	LinkedList* list = ListInitialiseCompact(sizeof(int));
+
+	for (int i = 0; i < 50000; i++)
+	{
+		ListPushBack(list, &i);
+	}
+
+	int threshold = 2;
+	size_t removedCount = 0;
+
+	int resultOne = ListRemoveIf(list, IsItemGreaterThan, &threshold, &removedCount);
+	int resultTwo = ListPopRange(list, 1, 2);
+
+	int item = 7;
+	ListPushBack(list, &item);
+
+	int expectedItems[2] = { 0, 7 };
+
+	TEST_ASSERT_EQUAL(0, resultOne);
+	TEST_ASSERT_EQUAL(0, resultTwo);
+	TEST_ASSERT_EQUAL(49997, removedCount);
+	AssertItemsEqual(list, expectedItems, 2);
+
+	ListDestroy(&list);
+}
+
+void ListInsertSorted_InsertsClusteredInOneGap_KeepsOrderAndFindsItems(void)
+{
+	LinkedList* list = ListInitialiseSorted(sizeof(int), CompareItems);
+
+	for (int i = 0; i < 4000; i++)
+	{
+		int item = i * 10000;
+		ListInsertSorted(list, &item);
+	}
+
+	for (int i = 1; i <= 8000; i++)
+	{
+		int item = 20000000 + i;
+		ListInsertSorted(list, &item);
+	}
+
+	int* items = malloc(12000 * sizeof(int));
+	ListGetRange(list, 0, 12000, items);
+
+	int outOfOrderItems = 0;
+
+	for (int i = 1; i < 12000; i++)
+	{
+		outOfOrderItems += items[i - 1] > items[i];
+	}
+
+	free(items);
+
+	size_t index = 0;
+	int item = 20004000;
+	int result = ListFindSorted(list, &index, &item);
+
+	TEST_ASSERT_EQUAL(0, outOfOrderItems);
+	TEST_ASSERT_EQUAL(0, result);
+	TEST_ASSERT_EQUAL(6000, index);
+
+	ListDestroy(&list);
+}
+
+void WorkDequeSteal_OddAndLargeItemSizes_CopiesWholeItems(void)
+{
+	WorkDeque* smallDeque = WorkDequeInitialise(3);
+	WorkDeque* largeDeque = WorkDequeInitialise(300);
+
+	unsigned char smallItem[3] = { 1, 2, 3 };
+	unsigned char largeItem[300];
+
+	for (size_t i = 0; i < sizeof(largeItem); i++)
+	{
+		largeItem[i] = (unsigned char)i;
+	}
+
+	WorkDequePush(smallDeque, smallItem);
+	WorkDequePush(largeDeque, largeItem);
+	WorkDequePush(largeDeque, largeItem);
+
+	unsigned char stolenSmallItem[4] = { 0, 0, 0, 9 };
+	unsigned char stolenLargeItem[300] = { 0 };
+	unsigned char poppedLargeItem[300] = { 0 };
+	unsigned char untouchedItem[3] = { 7, 7, 7 };
+
+	int resultOne = WorkDequeSteal(smallDeque, stolenSmallItem);
+	int resultTwo = WorkDequeSteal(largeDeque, stolenLargeItem);
+	int resultThree = WorkDequePop(largeDeque, poppedLargeItem);
+	int resultFour = WorkDequePop(smallDeque, untouchedItem);
+
+	TEST_ASSERT_EQUAL(0, resultOne);
+	TEST_ASSERT_EQUAL(0, resultTwo);
+	TEST_ASSERT_EQUAL(0, resultThree);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultFour);
+	TEST_ASSERT_EQUAL(0, memcmp(smallItem, stolenSmallItem, 3));
+	TEST_ASSERT_EQUAL(9, stolenSmallItem[3]);
+	TEST_ASSERT_EQUAL(0, memcmp(largeItem, stolenLargeItem, 300));
+	TEST_ASSERT_EQUAL(0, memcmp(largeItem, poppedLargeItem, 300));
+	TEST_ASSERT_EQUAL(7, untouchedItem[0]);
+
+	WorkDequeDestroy(&smallDeque);
+	WorkDequeDestroy(&largeDeque);
+}
+
+void ListPopFront_RingPoppedEmpty_ReturnsErrorListEmpty(void)
+{
+	LinkedList* list = ListInitialiseRing(sizeof(int), 4);
+
+	int item = 5;
+	ListPushBack(list, &item);
+
+	int resultOne = ListPopFront(list);
+	int resultTwo = ListPopFront(list);
+
+	TEST_ASSERT_EQUAL(0, resultOne);
+	TEST_ASSERT_EQUAL(ERROR_LIST_EMPTY, resultTwo);
+	TEST_ASSERT_EQUAL(0, ListCount(list));
+
+	ListDestroy(&list);
+}
+
 int main(void)
 {
 	UNITY_BEGIN();
@@ -711,5 +3756,116 @@ int main(void)
 	MY_RUN_TEST(ListReplace_IllegalParameters_ReturnsErrorCode);
 	MY_RUN_TEST(ListReplace_LinkedListIndexAndReplaceItem_ReplacesItemAtIndexAndReturnsZero);
 
+	MY_RUN_TEST(ListGetRange_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListGetRange_LinkedListStartAndCount_CopiesItemsIntoBufferAndReturnsZero);
+	MY_RUN_TEST(ListPopRange_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListPopRange_LinkedListStartAndCount_RemovesItemsDecreasesCountAndReturnsZero);
+	MY_RUN_TEST(ListPopRange_SharedElements_KeepsCloneAndPushesAfterTailRun);
+	MY_RUN_TEST(ListReplaceRange_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListReplaceRange_LinkedListStartCountAndItems_ReplacesItemsAndReturnsZero);
+	MY_RUN_TEST(ListRemoveIf_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListRemoveIf_LinkedListAndPredicate_RemovesMatchingItemsKeepsOrderAndReturnsZero);
+	MY_RUN_TEST(ListRetainIf_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListRetainIf_LinkedListAndPredicate_RemovesNonMatchingItemsKeepsOrderAndReturnsZero);
+	MY_RUN_TEST(ListClone_IllegalParameters_ReturnsNull);
+	MY_RUN_TEST(ListClone_LinkedList_ReturnsListWithSameItemsAndCount);
+	MY_RUN_TEST(ListClone_ModifyListAfterClone_CloneKeepsOriginalItems);
+	MY_RUN_TEST(ListClone_ModifyCloneAfterClone_ListKeepsOriginalItems);
+	MY_RUN_TEST(ListInsertSorted_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListInsertSorted_SortedListUnorderedItems_KeepsItemsOrderedAndReturnsZero);
+	MY_RUN_TEST(ListFindSorted_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListFindSorted_SortedListAfterPops_GetsIndexByPointerAndReturnsZero);
+	MY_RUN_TEST(ListLowerBound_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListLowerBound_SortedListAndItem_GetsIndexOfFirstItemNotLessAndReturnsZero);
+	MY_RUN_TEST(ListInsertSorted_SortedListClone_CloneKeepsOriginalItems);
+	MY_RUN_TEST(LruPut_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(LruPut_FullCache_EvictsLeastRecentlyUsedKeyAndCallsEvict);
+	MY_RUN_TEST(LruGet_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(LruGet_ManyKeysThroughSmallCache_GetsMostRecentValues);
+	MY_RUN_TEST(ListReadBegin_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListReadBegin_ConcurrentListWithWriter_ReadersSeeOnlyValidItems);
+	MY_RUN_TEST(ListInitialiseWithAllocator_IllegalParameters_ReturnsNull);
+	MY_RUN_TEST(ListInitialiseWithAllocator_CustomAllocator_RoutesEveryAllocationThroughAllocator);
+	MY_RUN_TEST(ListInitialiseWithAllocator_CustomAllocator_RoutesScratchMemoryThroughAllocator);
+	MY_RUN_TEST(ListInitialiseWithAllocator_ThreadCacheAllocator_KeepsItemsAndReturnsList);
+	MY_RUN_TEST(ListInitialiseDeque_ElementSize_ReturnsListAndCountZero);
+	MY_RUN_TEST(ListInitialiseDeque_RandomOperations_BehavesLikeLinkedList);
+	MY_RUN_TEST(ListInitialiseRing_IllegalParameters_ReturnsNull);
+	MY_RUN_TEST(ListInitialiseRing_CapacityBeyondLargestPowerOfTwo_ReturnsNull);
+	MY_RUN_TEST(ListInitialiseRing_SlotsSizeOverflows_ReturnsNull);
+	MY_RUN_TEST(ListInitialiseRing_FullRing_PushBackReturnsErrorListFull);
+	MY_RUN_TEST(ListPushBackMany_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListPushBackMany_RingAcrossWrapAround_KeepsItemsInOrder);
+	MY_RUN_TEST(ListInitialiseRing_ProducerAndConsumerThreads_ConsumerGetsItemsInOrder);
+	MY_RUN_TEST(WorkDequeInitialise_IllegalParameters_ReturnsNull);
+	MY_RUN_TEST(WorkDequePush_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(WorkDequePush_PastInitialCapacity_PopTakesNewestAndStealTakesOldest);
+	MY_RUN_TEST(WorkDequeSteal_OwnerAndThieves_TakeEveryItemExactlyOnce);
+	MY_RUN_TEST(ListInitialiseCompact_ElementSize_ReturnsListAndCountZero);
+	MY_RUN_TEST(ListInitialiseCompact_RandomOperations_BehavesLikeLinkedList);
+	MY_RUN_TEST(ListInitialiseCompact_ReusedNodesAcrossChunks_KeepsItemsInOrder);
+	MY_RUN_TEST(ListClearIncremental_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListClearIncremental_Budget_RemovesAtMostBudgetElementsPerCall);
+	MY_RUN_TEST(ListClearIncremental_SharedElements_KeepsCloneIntact);
+	MY_RUN_TEST(ListDestroyAsync_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListDestroyAsync_CustomAllocator_FreesEveryAllocationInBackground);
+	MY_RUN_TEST(ListGetItems_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListGetItems_UnorderedIndices_ReturnsItemsInCallerOrder);
+	MY_RUN_TEST(ListGetItems_DequeList_ReturnsItemsInCallerOrder);
+	MY_RUN_TEST(ListMergeSorted_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListMergeSorted_InterleavedLists_RelinksSourceIntoDestination);
+	MY_RUN_TEST(ListMergeSorted_SortedDestinationWithClone_KeepsCloneAndFindsMergedItems);
+	MY_RUN_TEST(ListIntersectSorted_IllegalParameters_ReturnsNull);
+	MY_RUN_TEST(ListIntersectSorted_ListsWithDuplicates_ReturnsMultisetResults);
+	MY_RUN_TEST(ListMergeSorted_SourceSortedByOtherCompare_ReturnsErrorCode);
+	MY_RUN_TEST(ListUnionSorted_SortedLists_ReturnsSortedList);
+	MY_RUN_TEST(ListSortByKey_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListSortByKey_RandomKeys_SortsStablyWithoutMovingItems);
+	MY_RUN_TEST(ListSortByKey_SharedElements_KeepsCloneOrder);
+	MY_RUN_TEST(ListGetLatencyHistogram_IllegalParameters_ReturnsErrorCode);
+#ifdef LINKEDLIST_TRACING
+	MY_RUN_TEST(ListGetLatencyHistogram_TracedOperations_CountsEveryCall);
+#else
+	MY_RUN_TEST(ListGetLatencyHistogram_TracingDisabled_ReturnsErrorInvalidOperation);
+#endif
+	MY_RUN_TEST(ListRotate_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListRotate_CountLargerThanList_MovesElementsWithoutCopyingItems);
+	MY_RUN_TEST(ListRotate_SharedElements_KeepsCloneOrder);
+	MY_RUN_TEST(ListRotate_RandomOperations_BehavesLikeDeque);
+	MY_RUN_TEST(ListCompact_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListCompact_ScatteredList_KeepsItemsAndRemovesFragmentation);
+	MY_RUN_TEST(ListCompact_SharedElements_KeepsCloneItems);
+	MY_RUN_TEST(ListCompact_RandomOperations_BehavesLikeDeque);
+	MY_RUN_TEST(ListInitialiseTiered_IllegalParameters_ReturnsNull);
+	MY_RUN_TEST(ListInitialiseTiered_RandomOperations_BehavesLikeDeque);
+	MY_RUN_TEST(ListInitialiseTiered_QueueLargerThanBudget_KeepsItemsInOrder);
+	MY_RUN_TEST(ListInitialiseCompressed_ElementSize_ReturnsListForIntegerSizes);
+	MY_RUN_TEST(ListInitialiseCompressed_RandomOperations_BehavesLikeDeque);
+	MY_RUN_TEST(ListInitialiseCompressed_WideValues_KeepsEveryBit);
+	MY_RUN_TEST(ListInitialiseSelfOrganising_Organisation_ReturnsListForValidOrganisations);
+	MY_RUN_TEST(ListGetIndex_MoveToFront_MovesFoundItemToFront);
+	MY_RUN_TEST(ListGetIndex_Transpose_SwapsFoundItemWithPredecessor);
+	MY_RUN_TEST(ListGetIndex_FrequencyCount_OrdersItemsByHits);
+	MY_RUN_TEST(ListGetIndex_SelfOrganisingClone_KeepsOriginalOrder);
+	MY_RUN_TEST(ListConcatenate_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListConcatenate_TwoLists_MovesSourceBehindDestination);
+	MY_RUN_TEST(ListConcatenate_EmptyDestination_TakesSourceElements);
+	MY_RUN_TEST(ListConcatenate_SharedLists_KeepsClonesUnchanged);
+	MY_RUN_TEST(ListShardedInitialise_IllegalParameters_ReturnsNull);
+	MY_RUN_TEST(ListShardedPushBack_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(ListShardedCollect_FilledShards_AppendsShardsInOrder);
+	MY_RUN_TEST(ListShardedPushBack_ThreadPerShard_CollectKeepsEveryItemInOrder);
+	MY_RUN_TEST(LockFreeListInitialise_IllegalParameters_ReturnsNull);
+	MY_RUN_TEST(LockFreeListInsert_IllegalParameters_ReturnsErrorCode);
+	MY_RUN_TEST(LockFreeListInsert_ShuffledItems_KeepsEachItemOnce);
+	MY_RUN_TEST(LockFreeListRemove_RacingThreads_SuccessfulInsertsAndRemovesAlternate);
+	MY_RUN_TEST(ListInitialiseTiered_ExistingFileAtPath_LeavesFileUntouched);
+	MY_RUN_TEST(ListGetItems_TieredIndicesAcrossSegments_ReturnsEveryItem);
+	MY_RUN_TEST(ListGetItems_CompressedIndicesAcrossBlocks_ReturnsEveryItem);
+	MY_RUN_TEST(ListRemoveIf_CompactListLargeTail_DropsTailAndKeepsPushing);
+	MY_RUN_TEST(ListInsertSorted_InsertsClusteredInOneGap_KeepsOrderAndFindsItems);
+	MY_RUN_TEST(WorkDequeSteal_OddAndLargeItemSizes_CopiesWholeItems);
+	MY_RUN_TEST(ListPopFront_RingPoppedEmpty_ReturnsErrorListEmpty);
+
 	return UNITY_END();
 }